@@ -30,25 +30,54 @@ SOFTWARE.
 #pragma once
 
 #include <include/non_copyable.h>
+#include <include/cpu_pause.h>
 
 #include <thread>
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <algorithm>
+#include <type_traits>
 
 
 namespace lime
 {
 
-    class atomic_spin_lock final :
+    enum class lock_statistics_mode : std::uint32_t
+    {
+        disabled    = 0,
+        enabled     = 1
+    };
+
+
+    struct lock_statistics
+    {
+        std::uint64_t               acquisitions_{0};
+        std::uint64_t               contendedAcquisitions_{0};
+        std::uint64_t               spins_{0};              // cpu_pause iterations spent waiting
+        std::chrono::nanoseconds    maximumHoldTime_{0};
+    };
+
+
+    //=========================================================================
+    // test and test and set spin lock.  waiters spin on a relaxed load (the line stays
+    // shared rather than being pulled exclusive by every waiter) with cpu_pause and a
+    // bounded exponential backoff and only attempt the exchange once the lock appears free.
+    template <lock_statistics_mode M = lock_statistics_mode::disabled>
+    class basic_atomic_spin_lock final :
         non_copyable
     {
     public:
 
-        atomic_spin_lock() = default;
-        ~atomic_spin_lock() = default;
+        static auto constexpr statistics_mode = M;
+        static auto constexpr minimum_backoff = 1u;
+        static auto constexpr maximum_backoff = 32u;
+
+        basic_atomic_spin_lock() = default;
+        ~basic_atomic_spin_lock() = default;
 
-        atomic_spin_lock(atomic_spin_lock &&) = default;
-        atomic_spin_lock & operator = (atomic_spin_lock &&) = default;
+        basic_atomic_spin_lock(basic_atomic_spin_lock &&) = default;
+        basic_atomic_spin_lock & operator = (basic_atomic_spin_lock &&) = default;
 
         void lock();
 
@@ -56,41 +85,148 @@ namespace lime
 
         bool try_lock();
 
+        lock_statistics get_statistics() const requires (M == lock_statistics_mode::enabled);
+
     private:
 
+        // written only by the lock owner.  atomic so that they can be read at any time.
+        struct statistics
+        {
+            std::atomic<std::uint64_t>  acquisitions_{0};
+            std::atomic<std::uint64_t>  contendedAcquisitions_{0};
+            std::atomic<std::uint64_t>  spins_{0};
+            std::atomic<std::int64_t>   maximumHoldTime_{0};
+            std::int64_t                acquireTime_{0};
+        };
+
+        struct no_statistics
+        {
+        };
+
+        static std::int64_t now();
+
+        void on_acquire
+        (
+            std::uint64_t
+        );
+
         std::atomic<std::thread::id> value_{};
 
-    }; // atomic_spin_lock
+        [[no_unique_address]] std::conditional_t<M == lock_statistics_mode::enabled, statistics, no_statistics> statistics_;
+
+    }; // basic_atomic_spin_lock
+
+
+    using atomic_spin_lock = basic_atomic_spin_lock<lock_statistics_mode::disabled>;
+    using instrumented_atomic_spin_lock = basic_atomic_spin_lock<lock_statistics_mode::enabled>;
 
 } // namespace lime
 
 
 //=============================================================================
-inline void lime::atomic_spin_lock::lock
+template <lime::lock_statistics_mode M>
+inline std::int64_t lime::basic_atomic_spin_lock<M>::now
 (
 )
 {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+//=============================================================================
+template <lime::lock_statistics_mode M>
+inline void lime::basic_atomic_spin_lock<M>::on_acquire
+(
+    [[maybe_unused]] std::uint64_t spins
+)
+{
+    if constexpr (M == lock_statistics_mode::enabled)
+    {
+        auto & s = statistics_;
+        s.acquisitions_.store(s.acquisitions_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (spins > 0)
+        {
+            s.contendedAcquisitions_.store(s.contendedAcquisitions_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            s.spins_.store(s.spins_.load(std::memory_order_relaxed) + spins, std::memory_order_relaxed);
+        }
+        s.acquireTime_ = now();
+    }
+}
+
+
+//=============================================================================
+template <lime::lock_statistics_mode M>
+inline void lime::basic_atomic_spin_lock<M>::lock
+(
+)
+{
+    auto self = std::this_thread::get_id();
     std::thread::id expected = {};
-    while (not value_.compare_exchange_strong(expected, std::this_thread::get_id()))
-        ;
+    if (value_.compare_exchange_strong(expected, self, std::memory_order_acquire))
+        return on_acquire(0);
+
+    std::uint64_t spins = 0;
+    auto backoff = minimum_backoff;
+    while (true)
+    {
+        while (value_.load(std::memory_order_relaxed) != std::thread::id{})
+        {
+            for (auto i = 0u; i < backoff; ++i)
+                cpu_pause();
+            spins += backoff;
+            backoff = std::min(backoff * 2, maximum_backoff);
+        }
+        expected = {};
+        if (value_.compare_exchange_weak(expected, self, std::memory_order_acquire))
+            return on_acquire(std::max<std::uint64_t>(spins, 1));
+    }
 }
 
 
 //=============================================================================
-inline void lime::atomic_spin_lock::unlock
+template <lime::lock_statistics_mode M>
+inline void lime::basic_atomic_spin_lock<M>::unlock
 (
 )
 {
-    auto expected = std::this_thread::get_id();
-    value_.compare_exchange_strong(expected, {});
+    // only the owner can release the lock.  no other thread can change value_ while
+    // it holds the owner's id so a load and a release store replace the exchange.
+    if (value_.load(std::memory_order_relaxed) != std::this_thread::get_id())
+        return;
+    if constexpr (M == lock_statistics_mode::enabled)
+    {
+        auto & s = statistics_;
+        if (auto holdTime = (now() - s.acquireTime_); holdTime > s.maximumHoldTime_.load(std::memory_order_relaxed))
+            s.maximumHoldTime_.store(holdTime, std::memory_order_relaxed);
+    }
+    value_.store({}, std::memory_order_release);
 }
 
 
 //=============================================================================
-inline bool lime::atomic_spin_lock::try_lock
+template <lime::lock_statistics_mode M>
+inline bool lime::basic_atomic_spin_lock<M>::try_lock
 (
 )
 {
+    if (value_.load(std::memory_order_relaxed) != std::thread::id{})
+        return false;
     std::thread::id expected = {};
-    return value_.compare_exchange_strong(expected, std::this_thread::get_id());
+    if (not value_.compare_exchange_strong(expected, std::this_thread::get_id(), std::memory_order_acquire))
+        return false;
+    on_acquire(0);
+    return true;
+}
+
+
+//=============================================================================
+template <lime::lock_statistics_mode M>
+auto lime::basic_atomic_spin_lock<M>::get_statistics
+(
+) const -> lock_statistics requires (M == lock_statistics_mode::enabled)
+{
+    return {statistics_.acquisitions_.load(std::memory_order_relaxed), 
+            statistics_.contendedAcquisitions_.load(std::memory_order_relaxed),
+            statistics_.spins_.load(std::memory_order_relaxed),
+            std::chrono::nanoseconds(statistics_.maximumHoldTime_.load(std::memory_order_relaxed))};
 }
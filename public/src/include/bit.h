@@ -30,6 +30,7 @@ SOFTWARE.
 #pragma once
 
 #include <bit>
+#include <concepts>
 #include <cstdint>
 
 
@@ -0,0 +1,475 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./non_copyable.h"
+#include "./cache_line.h"
+#include "./bit.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+namespace lime
+{
+
+    enum class broadcast_overflow_policy : std::uint32_t
+    {
+        back_pressure   = 0,    // the producer fails to push while the slowest reader is a full ring behind
+        overwrite       = 1     // the producer never waits.  readers which are lapped skip ahead and count the loss
+    };
+
+
+    //=========================================================================
+    // single producer, multiple consumer broadcast ring.  every reader sees every value
+    // (subject to the overflow policy) and each value is written once regardless of the
+    // number of readers.  the producer owns one write cursor and each reader owns a read
+    // cursor on its own cache line.
+    //
+    // with back_pressure readers access values in place (front/pop).  with overwrite a
+    // slot may be rewritten while it is being read so values are held as relaxed atomic
+    // words, copied out and validated against a per slot sequence (try_pop) which requires
+    // T to be trivially copyable.
+    template <typename T, broadcast_overflow_policy P = broadcast_overflow_policy::back_pressure, typename A = std::allocator<T>>
+    requires ((P == broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+    class broadcast_ring : non_copyable
+    {
+    public:
+
+        using type = T;
+        using value_type = T;
+        static auto constexpr overflow_policy = P;
+        using allocator_type = A;
+
+        class reader;
+
+        broadcast_ring
+        (
+            std::size_t,
+            std::size_t,
+            allocator_type const & = allocator_type()
+        );
+
+        broadcast_ring(broadcast_ring &&) = delete;
+        broadcast_ring & operator = (broadcast_ring &&) = delete;
+        ~broadcast_ring() = default;
+
+        template <typename T_>
+        bool push
+        (
+            T_ &&
+        );
+
+        template <typename ... Ts>
+        bool emplace
+        (
+            Ts && ...
+        );
+
+        reader get_reader
+        (
+            std::size_t
+        );
+
+        std::size_t capacity() const;
+
+        std::size_t reader_count() const;
+
+    private:
+
+        static auto constexpr sequenced = (P == broadcast_overflow_policy::overwrite);
+
+        static auto constexpr word_count = ((sizeof(type) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+
+        using words = std::array<std::uint64_t, word_count>;
+
+        struct plain_slot
+        {
+            type                                                value_;
+        };
+
+        struct sequenced_slot
+        {
+            // 2n + 1 while position n is being written, 2n + 2 once it is published
+            std::atomic<std::uint64_t>                          sequence_{0};
+            std::array<std::atomic<std::uint64_t>, word_count>  value_{};
+        };
+
+        using slot = std::conditional_t<sequenced, sequenced_slot, plain_slot>;
+
+        struct alignas(cache_line_size) reader_cursor
+        {
+            std::atomic<std::uint64_t>  position_{0};
+            std::atomic<std::uint64_t>  lagCount_{0};
+            std::uint64_t               cachedWriterPosition_{0};
+        };
+
+        template <typename F>
+        bool write
+        (
+            F &&
+        ) requires (not sequenced);
+
+        bool publish
+        (
+            type const &
+        ) requires (sequenced);
+
+        std::uint64_t get_minimum_reader_position() const;
+
+        // producer owned line
+        alignas(cache_line_size) std::atomic<std::uint64_t> writerPosition_{0};
+        std::uint64_t                                       cachedMinimumReaderPosition_{0};
+
+        std::size_t                                         capacity_;
+        std::size_t                                         capacityMask_;
+
+        std::vector<slot, typename std::allocator_traits<A>::template rebind_alloc<slot>> ring_;
+        std::vector<reader_cursor>                          readerCursors_;
+    };
+
+
+    //=========================================================================
+    // a consumer's handle on the ring.  each reader must be used by one thread at a time.
+    template <typename T, broadcast_overflow_policy P, typename A>
+    requires ((P == broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+    class broadcast_ring<T, P, A>::reader
+    {
+    public:
+
+        reader() = default;
+
+        T const * front() requires (not sequenced);
+
+        void pop() requires (not sequenced);
+
+        bool try_pop
+        (
+            type &
+        );
+
+        bool empty() const;
+
+        std::uint64_t get_lag_count() const;
+
+    private:
+
+        friend class broadcast_ring;
+
+        reader
+        (
+            broadcast_ring &,
+            reader_cursor &
+        );
+
+        broadcast_ring *    ring_{nullptr};
+        reader_cursor *     cursor_{nullptr};
+    };
+
+} // namespace lime
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+lime::broadcast_ring<T, P, A>::broadcast_ring
+(
+    std::size_t capacity,
+    std::size_t readerCount,
+    allocator_type const & allocator
+):
+    capacity_(minimum_power_of_two(std::max<std::size_t>(capacity, 1))),
+    capacityMask_(capacity_ - 1),
+    ring_(capacity_, allocator),
+    readerCursors_(readerCount)
+{
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline std::size_t lime::broadcast_ring<T, P, A>::capacity
+(
+) const
+{
+    return capacity_;
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline std::size_t lime::broadcast_ring<T, P, A>::reader_count
+(
+) const
+{
+    return readerCursors_.size();
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+auto lime::broadcast_ring<T, P, A>::get_reader
+(
+    std::size_t index
+) -> reader
+{
+    return {*this, readerCursors_[index]};
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+std::uint64_t lime::broadcast_ring<T, P, A>::get_minimum_reader_position
+(
+) const
+{
+    auto minimum = std::numeric_limits<std::uint64_t>::max();
+    for (auto const & readerCursor : readerCursors_)
+        minimum = std::min(minimum, readerCursor.position_.load(std::memory_order_acquire));
+    return minimum;
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+template <typename F>
+inline bool lime::broadcast_ring<T, P, A>::write
+(
+    // back_pressure.  assigns the value in place once the slowest reader has released the slot
+    F && assign
+) requires (not sequenced)
+{
+    auto position = writerPosition_.load(std::memory_order_relaxed);
+    if ((position - cachedMinimumReaderPosition_) >= capacity_)
+    {
+        // only scan the reader cursors when the ring appears full
+        cachedMinimumReaderPosition_ = get_minimum_reader_position();
+        if ((position - cachedMinimumReaderPosition_) >= capacity_)
+            return false;
+    }
+    assign(ring_[position & capacityMask_].value_);
+    writerPosition_.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline bool lime::broadcast_ring<T, P, A>::publish
+(
+    // overwrite.  never waits.  the value is stored as relaxed atomic words bracketed by
+    // the slot's sequence so that readers racing with the store see a torn copy which
+    // fails validation rather than a data race.
+    type const & value
+) requires (sequenced)
+{
+    words source{};
+    std::memcpy(source.data(), &value, sizeof(type));
+
+    auto position = writerPosition_.load(std::memory_order_relaxed);
+    auto & slot = ring_[position & capacityMask_];
+    slot.sequence_.store((position * 2) + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (auto i = 0ull; i < word_count; ++i)
+        slot.value_[i].store(source[i], std::memory_order_relaxed);
+    slot.sequence_.store((position * 2) + 2, std::memory_order_release);
+    writerPosition_.store(position + 1, std::memory_order_release);
+    return true;
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+template <typename T_>
+inline bool lime::broadcast_ring<T, P, A>::push
+(
+    T_ && value
+)
+{
+    if constexpr (sequenced)
+        return publish(type(std::forward<T_>(value)));
+    else
+        return write([&](type & target){target = std::forward<T_>(value);});
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+template <typename ... Ts>
+inline bool lime::broadcast_ring<T, P, A>::emplace
+(
+    Ts && ... args
+)
+{
+    if constexpr (sequenced)
+        return publish(T(std::forward<Ts>(args) ...));
+    else
+        return write([&](type & target){target = T(std::forward<Ts>(args) ...);});
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+lime::broadcast_ring<T, P, A>::reader::reader
+(
+    broadcast_ring & ring,
+    reader_cursor & cursor
+):
+    ring_(&ring),
+    cursor_(&cursor)
+{
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline T const * lime::broadcast_ring<T, P, A>::reader::front
+(
+    // in place access to the next value or nullptr if there is none.  the value remains
+    // valid until pop() as the producer can not overwrite a slot this reader has not released.
+) requires (not sequenced)
+{
+    auto position = cursor_->position_.load(std::memory_order_relaxed);
+    if (cursor_->cachedWriterPosition_ == position)
+    {
+        cursor_->cachedWriterPosition_ = ring_->writerPosition_.load(std::memory_order_acquire);
+        if (cursor_->cachedWriterPosition_ == position)
+            return nullptr;
+    }
+    return &ring_->ring_[position & ring_->capacityMask_].value_;
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline void lime::broadcast_ring<T, P, A>::reader::pop
+(
+    // release the value returned by front()
+) requires (not sequenced)
+{
+    cursor_->position_.store(cursor_->position_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline bool lime::broadcast_ring<T, P, A>::reader::try_pop
+(
+    type & value
+)
+{
+    if constexpr (not sequenced)
+    {
+        if (auto next = front(); next != nullptr)
+        {
+            value = *next;
+            pop();
+            return true;
+        }
+        return false;
+    }
+    else
+    {
+        while (true)
+        {
+            auto position = cursor_->position_.load(std::memory_order_relaxed);
+            auto const & slot = ring_->ring_[position & ring_->capacityMask_];
+            auto expected = (position * 2) + 2;
+            auto sequence = slot.sequence_.load(std::memory_order_acquire);
+            if (sequence == expected)
+            {
+                words destination;
+                for (auto i = 0ull; i < word_count; ++i)
+                    destination[i] = slot.value_[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.sequence_.load(std::memory_order_relaxed) == expected)
+                {
+                    std::memcpy(&value, destination.data(), sizeof(type));
+                    cursor_->position_.store(position + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (sequence < expected)
+            {
+                return false; // not yet written
+            }
+            // lapped by the producer.  skip to the oldest value which has not yet been overwritten
+            auto writerPosition = ring_->writerPosition_.load(std::memory_order_acquire);
+            auto resumePosition = std::max(position + 1, writerPosition - std::min<std::uint64_t>(writerPosition, ring_->capacity_ - 1));
+            cursor_->lagCount_.store(cursor_->lagCount_.load(std::memory_order_relaxed) + (resumePosition - position), std::memory_order_relaxed);
+            cursor_->position_.store(resumePosition, std::memory_order_release);
+        }
+    }
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline bool lime::broadcast_ring<T, P, A>::reader::empty
+(
+) const
+{
+    return (ring_->writerPosition_.load(std::memory_order_acquire) == cursor_->position_.load(std::memory_order_relaxed));
+}
+
+
+//==============================================================================
+template <typename T, lime::broadcast_overflow_policy P, typename A>
+requires ((P == lime::broadcast_overflow_policy::back_pressure) || (std::is_trivially_copyable_v<T>))
+inline std::uint64_t lime::broadcast_ring<T, P, A>::reader::get_lag_count
+(
+    // number of values this reader lost to being overwritten
+) const
+{
+    return cursor_->lagCount_.load(std::memory_order_relaxed);
+}
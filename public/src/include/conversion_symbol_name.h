@@ -0,0 +1,186 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./symbol_name.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // validated conversion of text into symbol names in bulk.  a valid symbol is 1 to
+    // capacity() printable, non space ascii characters (0x21 - 0x7e).  unlike the symbol_name
+    // constructors, which truncate, over long or malformed input is rejected.
+    //
+    // with sse2 each 16 byte chunk is validated and padded with the fill character in
+    // registers (no per character loop).  full chunks of the source are loaded directly and
+    // a partial chunk via a zero padded copy so nothing beyond the source is read.
+    [[__maybe_unused__]]
+    static inline bool to_symbol_name
+    (
+        std::string_view source,
+        symbol_name_concept auto & destination
+    )
+    {
+        using symbol_type = std::decay_t<decltype(destination)>;
+        static auto constexpr capacity = symbol_type::capacity();
+        static auto constexpr fill = symbol_type::get_fill_character();
+
+        if ((source.empty()) || (source.size() > capacity))
+            return false;
+
+        #if defined(__SSE2__)
+            static auto constexpr chunk_size = std::size_t(16);
+            static auto constexpr chunk_count = ((capacity + chunk_size - 1) / chunk_size);
+
+            alignas(chunk_size) char buffer[chunk_count * chunk_size];
+            auto const lanes = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            auto invalid = 0;
+            for (auto chunk = std::size_t(0); chunk < chunk_count; ++chunk)
+            {
+                // chunks beyond the end of the source are empty and address its end (never past it)
+                auto offset = (chunk * chunk_size);
+                auto start = std::min(source.size(), offset);
+                auto length = static_cast<int>(std::min(source.size() - start, chunk_size));
+                auto address = (source.data() + start);
+                __m128i characters;
+                if (length == static_cast<int>(chunk_size))
+                {
+                    characters = _mm_loadu_si128(reinterpret_cast<__m128i const *>(address));
+                }
+                else
+                {
+                    alignas(chunk_size) char padded[chunk_size] = {};
+                    std::memcpy(padded, address, std::max(length, 0));
+                    characters = _mm_load_si128(reinterpret_cast<__m128i const *>(padded));
+                }
+                auto inSymbol = _mm_cmplt_epi8(lanes, _mm_set1_epi8(static_cast<char>(length)));
+                auto printable = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8(0x20)), _mm_cmplt_epi8(characters, _mm_set1_epi8(0x7f)));
+                invalid |= _mm_movemask_epi8(_mm_andnot_si128(printable, inSymbol));
+                auto padded = _mm_or_si128(_mm_and_si128(inSymbol, characters), _mm_andnot_si128(inSymbol, _mm_set1_epi8(fill)));
+                _mm_store_si128(reinterpret_cast<__m128i *>(buffer + offset), padded);
+            }
+            if (invalid != 0)
+                return false;
+            typename symbol_type::value_type value;
+            std::memcpy(value.data(), buffer, capacity);
+            destination = symbol_type(value);
+        #else
+            typename symbol_type::value_type value;
+            value.fill(fill);
+            for (auto i = 0ull; i < source.size(); ++i)
+            {
+                if ((source[i] <= 0x20) || (source[i] >= 0x7f))
+                    return false;
+                value[i] = source[i];
+            }
+            destination = symbol_type(value);
+        #endif
+        return true;
+    }
+
+
+    //=========================================================================
+    // converts source[i] into destination[i] for as many entries as both spans hold.
+    // stops at the first invalid entry and returns the number converted.
+    template <symbol_name_concept S, std::size_t E>
+    static inline std::size_t to_symbol_names
+    (
+        std::span<std::string_view const> source,
+        std::span<S, E> destination
+    )
+    {
+        auto count = std::min(source.size(), destination.size());
+        for (auto i = 0ull; i < count; ++i)
+            if (!to_symbol_name(source[i], destination[i]))
+                return i;
+        return count;
+    }
+
+
+    //=========================================================================
+    // appends the symbol in field 'column' of each line of delimited text (such as
+    // reference data files) to destination.  blank lines are skipped and a trailing '\r'
+    // is ignored.  returns the number of symbols appended or nullopt if a line is missing
+    // the column or its symbol is invalid (in which case the symbols of the preceding
+    // lines remain appended).
+    template <symbol_name_concept S>
+    static inline std::optional<std::size_t> parse_symbol_names
+    (
+        std::string_view text,
+        std::vector<S> & destination,
+        char delimiter = ',',
+        std::size_t column = 0
+    )
+    {
+        auto initialSize = destination.size();
+        destination.reserve(initialSize + (std::count(text.begin(), text.end(), '\n') + 1));
+        while (!text.empty())
+        {
+            auto lineEnd = static_cast<char const *>(std::memchr(text.data(), '\n', text.size()));
+            auto line = text.substr(0, (lineEnd == nullptr) ? text.size() : (lineEnd - text.data()));
+            text.remove_prefix((lineEnd == nullptr) ? text.size() : (line.size() + 1));
+            if ((!line.empty()) && (line.back() == '\r'))
+                line.remove_suffix(1);
+            if (line.empty())
+                continue;
+
+            for (auto i = 0ull; i < column; ++i)
+            {
+                auto fieldEnd = line.find(delimiter);
+                if (fieldEnd == std::string_view::npos)
+                    return std::nullopt;
+                line.remove_prefix(fieldEnd + 1);
+            }
+            line = line.substr(0, line.find(delimiter));
+            if (!to_symbol_name(line, destination.emplace_back()))
+            {
+                destination.pop_back();
+                return std::nullopt;
+            }
+        }
+        return (destination.size() - initialSize);
+    }
+
+} // namespace lime
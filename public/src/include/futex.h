@@ -0,0 +1,84 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <atomic>
+#include <climits>
+#include <cstdint>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace lime
+{
+
+    enum class futex_scope : std::uint32_t
+    {
+        process_private = 0,    // waiters and wakers share an address space (FUTEX_PRIVATE_FLAG)
+        process_shared  = 1     // the futex word lives in memory shared between processes
+    };
+
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t), "futex word must be a plain 32 bit integer");
+
+
+    //=========================================================================
+    // block the calling thread while 'address' holds 'expected'.  returns immediately if
+    // the value has already changed.  spurious wake ups are possible so callers must re-check
+    // their condition.
+    [[__maybe_unused__]]
+    static inline long futex_wait
+    (
+        std::atomic<std::uint32_t> & address,
+        std::uint32_t expected,
+        futex_scope scope = futex_scope::process_private
+    ) noexcept
+    {
+        auto operation = (scope == futex_scope::process_private) ? FUTEX_WAIT_PRIVATE : FUTEX_WAIT;
+        return ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&address), operation, expected, nullptr, nullptr, 0);
+    }
+
+
+    //=========================================================================
+    // wake up to 'count' threads blocked on 'address'.  returns the number woken.
+    [[__maybe_unused__]]
+    static inline long futex_wake
+    (
+        std::atomic<std::uint32_t> & address,
+        std::uint32_t count = INT_MAX,
+        futex_scope scope = futex_scope::process_private
+    ) noexcept
+    {
+        auto operation = (scope == futex_scope::process_private) ? FUTEX_WAKE_PRIVATE : FUTEX_WAKE;
+        return ::syscall(SYS_futex, reinterpret_cast<std::uint32_t *>(&address), operation, count, nullptr, nullptr, 0);
+    }
+
+} // namespace lime
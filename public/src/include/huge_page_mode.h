@@ -0,0 +1,71 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+
+namespace lime
+{
+
+    enum class huge_page_mode : std::uint32_t
+    {
+        none            = 0,    // standard (4KB) pages
+        hugetlb         = 1,    // explicit huge pages from the hugetlbfs pool (must be reserved by the host)
+        transparent     = 2     // standard mapping with transparent huge pages requested via madvise
+    };
+
+    static auto constexpr standard_page_size = std::size_t(4) << 10;
+    static auto constexpr huge_page_size = std::size_t(2) << 20;
+
+
+    //=========================================================================
+    static inline constexpr auto get_page_size
+    (
+        huge_page_mode hugePageMode
+    )
+    {
+        return (hugePageMode == huge_page_mode::none) ? standard_page_size : huge_page_size;
+    }
+
+
+    //=========================================================================
+    static inline constexpr auto round_to_page_size
+    (
+        std::size_t size,
+        huge_page_mode hugePageMode
+    )
+    {
+        auto pageSize = get_page_size(hugePageMode);
+        return (((size + pageSize - 1) / pageSize) * pageSize);
+    }
+
+} // namespace lime
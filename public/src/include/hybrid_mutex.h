@@ -0,0 +1,199 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/non_copyable.h>
+#include <include/cache_line.h>
+#include <include/cpu_pause.h>
+#include <include/futex.h>
+#include <include/synchronization_mode.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // mutex which spins before it sleeps.
+    //
+    // synchronous:  spin only.  for isolated cores where the owner is never descheduled
+    //               and a futex round trip would dominate the hold time.
+    // asynchronous: spin for roughly spin_duration (calibrated to this cpu at start up)
+    //               then park on a futex.  for shared cores where the owner may be
+    //               descheduled and spinning would only burn the owner's time slice.
+    //
+    // the mode is chosen at construction so the same binary adapts to the host.
+    class hybrid_mutex final :
+        non_copyable
+    {
+    public:
+
+        static auto constexpr spin_duration = std::chrono::nanoseconds(4000);
+
+        explicit hybrid_mutex
+        (
+            synchronization_mode = synchronization_mode::asynchronous
+        );
+
+        ~hybrid_mutex() = default;
+
+        void lock();
+
+        void unlock();
+
+        bool try_lock();
+
+        synchronization_mode get_synchronization_mode() const;
+
+        static std::uint32_t get_spin_count();
+
+    private:
+
+        static auto constexpr unlocked = std::uint32_t(0);
+        static auto constexpr locked = std::uint32_t(1);
+        static auto constexpr contended = std::uint32_t(2);  // locked and there may be sleeping waiters
+
+        bool try_acquire();
+
+        alignas(cache_line_size) std::atomic<std::uint32_t> state_{unlocked};
+        synchronization_mode                                synchronizationMode_;
+        std::uint32_t                                       spinCount_;
+
+    }; // class hybrid_mutex
+
+} // namespace lime
+
+
+//=============================================================================
+inline lime::hybrid_mutex::hybrid_mutex
+(
+    synchronization_mode synchronizationMode
+):
+    synchronizationMode_(synchronizationMode),
+    spinCount_(get_spin_count())
+{
+}
+
+
+//=============================================================================
+inline std::uint32_t lime::hybrid_mutex::get_spin_count
+(
+    // the number of cpu_pause iterations which take approximately spin_duration on this
+    // cpu.  the latency of pause varies by more than 10x between micro architectures so
+    // a fixed iteration count would spin for very different lengths of time.
+)
+{
+    static std::uint32_t const spinCount = []()
+            {
+                static auto constexpr sample_iterations = 10000u;
+                auto start = std::chrono::steady_clock::now();
+                for (auto i = 0u; i < sample_iterations; ++i)
+                    cpu_pause();
+                auto elapsed = std::max<std::int64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(), 1);
+                auto count = (spin_duration.count() * sample_iterations) / elapsed;
+                return static_cast<std::uint32_t>(std::clamp<std::int64_t>(count, 16, 1 << 20));
+            }();
+    return spinCount;
+}
+
+
+//=============================================================================
+inline auto lime::hybrid_mutex::get_synchronization_mode
+(
+) const -> synchronization_mode
+{
+    return synchronizationMode_;
+}
+
+
+//=============================================================================
+inline bool lime::hybrid_mutex::try_acquire
+(
+)
+{
+    auto expected = unlocked;
+    return ((state_.load(std::memory_order_relaxed) == unlocked) &&
+            (state_.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed)));
+}
+
+
+//=============================================================================
+inline void lime::hybrid_mutex::lock
+(
+)
+{
+    auto expected = unlocked;
+    if (state_.compare_exchange_strong(expected, locked, std::memory_order_acquire, std::memory_order_relaxed))
+        return;
+
+    if (synchronizationMode_ == synchronization_mode::synchronous)
+    {
+        while (not try_acquire())
+            cpu_pause();
+        return;
+    }
+
+    for (auto i = 0u; i < spinCount_; ++i)
+    {
+        cpu_pause();
+        if (try_acquire())
+            return;
+    }
+
+    // park.  marking the state contended tells the owner to wake a waiter on release.
+    // if the exchange observes 'unlocked' the lock is acquired (conservatively marked
+    // contended which costs at most one spurious wake).
+    while (state_.exchange(contended, std::memory_order_acquire) != unlocked)
+        futex_wait(state_, contended);
+}
+
+
+//=============================================================================
+inline void lime::hybrid_mutex::unlock
+(
+)
+{
+    // only issue the syscall when a waiter may be sleeping
+    if (state_.exchange(unlocked, std::memory_order_release) == contended)
+        futex_wake(state_, 1);
+}
+
+
+//=============================================================================
+inline bool lime::hybrid_mutex::try_lock
+(
+)
+{
+    return try_acquire();
+}
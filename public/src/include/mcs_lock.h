@@ -0,0 +1,192 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/non_copyable.h>
+#include <include/cache_line.h>
+#include <include/cpu_pause.h>
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // mcs queue lock.  waiters form a linked queue and each spins on a flag in its own
+    // queue node (its own cache line) so a release invalidates only the successor's line.
+    // fifo ordering bounds the wait of every thread.
+    //
+    // queue nodes are taken from a per thread pool rather than being supplied by the
+    // caller which keeps the lock/unlock/try_lock interface.  a thread may hold any
+    // number of mcs locks at once but must release each lock on the thread that took it.
+    class mcs_lock final :
+        non_copyable
+    {
+    public:
+
+        mcs_lock() = default;
+        ~mcs_lock() = default;
+
+        void lock();
+
+        void unlock();
+
+        bool try_lock();
+
+    private:
+
+        struct alignas(cache_line_size) node
+        {
+            std::atomic<node *>     next_{nullptr};
+            std::atomic<bool>       locked_{false};
+            node *                  nextFree_{nullptr};
+        };
+
+        struct node_pool
+        {
+            ~node_pool()
+            {
+                while (free_ != nullptr)
+                    delete std::exchange(free_, free_->nextFree_);
+            }
+
+            node * free_{nullptr};
+        };
+
+        static node_pool & get_node_pool();
+
+        static node * acquire_node();
+
+        static void release_node
+        (
+            node *
+        );
+
+        alignas(cache_line_size) std::atomic<node *>    tail_{nullptr};
+        node *                                          owner_{nullptr}; // accessed only by the lock holder
+
+    }; // class mcs_lock
+
+} // namespace lime
+
+
+//=============================================================================
+inline auto lime::mcs_lock::get_node_pool
+(
+) -> node_pool &
+{
+    static thread_local node_pool nodePool;
+    return nodePool;
+}
+
+
+//=============================================================================
+inline auto lime::mcs_lock::acquire_node
+(
+) -> node *
+{
+    auto & nodePool = get_node_pool();
+    if (nodePool.free_ == nullptr)
+        return new node;
+    auto result = std::exchange(nodePool.free_, nodePool.free_->nextFree_);
+    result->next_.store(nullptr, std::memory_order_relaxed);
+    return result;
+}
+
+
+//=============================================================================
+inline void lime::mcs_lock::release_node
+(
+    node * releasedNode
+)
+{
+    auto & nodePool = get_node_pool();
+    releasedNode->nextFree_ = std::exchange(nodePool.free_, releasedNode);
+}
+
+
+//=============================================================================
+inline void lime::mcs_lock::lock
+(
+)
+{
+    auto self = acquire_node();
+    self->locked_.store(true, std::memory_order_relaxed);
+    if (auto predecessor = tail_.exchange(self, std::memory_order_acq_rel); predecessor != nullptr)
+    {
+        predecessor->next_.store(self, std::memory_order_release);
+        while (self->locked_.load(std::memory_order_acquire))
+            cpu_pause();
+    }
+    owner_ = self;
+}
+
+
+//=============================================================================
+inline void lime::mcs_lock::unlock
+(
+)
+{
+    auto self = owner_;
+    auto successor = self->next_.load(std::memory_order_acquire);
+    if (successor == nullptr)
+    {
+        // no visible successor.  if this node is still the tail the lock becomes free
+        if (auto expected = self; tail_.compare_exchange_strong(expected, nullptr, std::memory_order_release, std::memory_order_relaxed))
+            return release_node(self);
+        // a successor has swapped itself into the tail but has not yet linked itself
+        while ((successor = self->next_.load(std::memory_order_acquire)) == nullptr)
+            cpu_pause();
+    }
+    successor->locked_.store(false, std::memory_order_release);
+    release_node(self);
+}
+
+
+//=============================================================================
+inline bool lime::mcs_lock::try_lock
+(
+)
+{
+    if (tail_.load(std::memory_order_relaxed) != nullptr)
+        return false;
+    auto self = acquire_node();
+    node * expected = nullptr;
+    if (not tail_.compare_exchange_strong(expected, self, std::memory_order_acquire, std::memory_order_relaxed))
+    {
+        release_node(self);
+        return false;
+    }
+    owner_ = self;
+    return true;
+}
@@ -0,0 +1,274 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./huge_page_mode.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    struct memory_policy
+    {
+        static auto constexpr any_numa_node = -1;
+
+        int             numaNode_{any_numa_node};           // bind pages to this node (mbind MPOL_BIND)
+        huge_page_mode  hugePageMode_{huge_page_mode::none};
+        bool            prefault_{true};                    // touch every page at allocation rather than on first use
+        bool            lock_{false};                       // mlock the pages so they are never reclaimed
+
+        constexpr bool operator == (memory_policy const &) const = default;
+    };
+
+
+    //=========================================================================
+    // allocator for large, long lived arrays (queues, rings, buffers).  each allocation
+    // is a separate anonymous mapping which is optionally bound to a numa node, backed
+    // by huge pages, pre-faulted and locked so that no page faults or tlb misses from
+    // the allocation land on the critical path later.  not intended for small objects.
+    template <typename T>
+    class numa_allocator
+    {
+    public:
+
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::false_type;
+
+        numa_allocator() = default;
+
+        explicit numa_allocator
+        (
+            memory_policy
+        );
+
+        template <typename T_>
+        numa_allocator
+        (
+            numa_allocator<T_> const &
+        );
+
+        T * allocate
+        (
+            std::size_t
+        );
+
+        void deallocate
+        (
+            T *,
+            std::size_t
+        );
+
+        memory_policy get_memory_policy() const;
+
+        template <typename T_>
+        bool operator ==
+        (
+            numa_allocator<T_> const & other
+        ) const
+        {
+            return (memoryPolicy_ == other.get_memory_policy());
+        }
+
+    private:
+
+        std::size_t get_mapped_size
+        (
+            std::size_t
+        ) const;
+
+        void * map
+        (
+            std::size_t
+        ) const;
+
+        memory_policy   memoryPolicy_;
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <typename T>
+lime::numa_allocator<T>::numa_allocator
+(
+    memory_policy memoryPolicy
+):
+    memoryPolicy_(memoryPolicy)
+{
+}
+
+
+//=============================================================================
+template <typename T>
+template <typename T_>
+lime::numa_allocator<T>::numa_allocator
+(
+    numa_allocator<T_> const & other
+):
+    memoryPolicy_(other.get_memory_policy())
+{
+}
+
+
+//=============================================================================
+template <typename T>
+inline auto lime::numa_allocator<T>::get_memory_policy
+(
+) const -> memory_policy
+{
+    return memoryPolicy_;
+}
+
+
+//=============================================================================
+template <typename T>
+inline std::size_t lime::numa_allocator<T>::get_mapped_size
+(
+    std::size_t count
+) const
+{
+    return round_to_page_size(count * sizeof(T), memoryPolicy_.hugePageMode_);
+}
+
+
+//=============================================================================
+template <typename T>
+void * lime::numa_allocator<T>::map
+(
+    std::size_t mappedSize
+) const
+{
+    static auto constexpr protection = (PROT_READ | PROT_WRITE);
+    static auto constexpr flags = (MAP_PRIVATE | MAP_ANONYMOUS);
+
+    switch (memoryPolicy_.hugePageMode_)
+    {
+        case huge_page_mode::hugetlb:
+        {
+            auto address = ::mmap(nullptr, mappedSize, protection, flags | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1, 0);
+            return (address == MAP_FAILED) ? nullptr : address;
+        }
+        case huge_page_mode::transparent:
+        {
+            // khugepaged can only use a huge page for a huge page aligned range so over
+            // allocate by one huge page and trim the mapping to an aligned address.
+            auto address = ::mmap(nullptr, mappedSize + huge_page_size, protection, flags, -1, 0);
+            if (address == MAP_FAILED)
+                return nullptr;
+            auto begin = reinterpret_cast<std::uintptr_t>(address);
+            auto alignedBegin = ((begin + huge_page_size - 1) & ~(huge_page_size - 1));
+            if (auto head = (alignedBegin - begin); head > 0)
+                ::munmap(address, head);
+            if (auto tail = (huge_page_size - (alignedBegin - begin)); tail > 0)
+                ::munmap(reinterpret_cast<void *>(alignedBegin + mappedSize), tail);
+            ::madvise(reinterpret_cast<void *>(alignedBegin), mappedSize, MADV_HUGEPAGE);
+            return reinterpret_cast<void *>(alignedBegin);
+        }
+        case huge_page_mode::none:
+        default:
+        {
+            auto address = ::mmap(nullptr, mappedSize, protection, flags, -1, 0);
+            return (address == MAP_FAILED) ? nullptr : address;
+        }
+    }
+}
+
+
+//=============================================================================
+template <typename T>
+T * lime::numa_allocator<T>::allocate
+(
+    std::size_t count
+)
+{
+    auto mappedSize = get_mapped_size(count);
+    auto address = map(mappedSize);
+    if (address == nullptr)
+        throw std::bad_alloc();
+
+    if (memoryPolicy_.numaNode_ != memory_policy::any_numa_node)
+    {
+        // bind before the first touch so that every page is allocated on the requested node
+        static auto constexpr bits_per_word = (sizeof(unsigned long) * 8);
+        unsigned long nodeMask[4] = {};
+        auto node = static_cast<std::size_t>(memoryPolicy_.numaNode_);
+        if (node >= (std::extent_v<decltype(nodeMask)> * bits_per_word))
+        {
+            ::munmap(address, mappedSize);
+            throw std::bad_alloc();
+        }
+        nodeMask[node / bits_per_word] |= (1ul << (node % bits_per_word));
+        if (::syscall(SYS_mbind, address, mappedSize, MPOL_BIND, nodeMask, std::extent_v<decltype(nodeMask)> * bits_per_word, MPOL_MF_STRICT) != 0)
+        {
+            ::munmap(address, mappedSize);
+            throw std::bad_alloc();
+        }
+    }
+
+    if (memoryPolicy_.prefault_)
+    {
+        // write (rather than read) each page so that a private page is allocated now
+        // instead of the shared zero page being mapped until the first write.
+        auto pageSize = get_page_size(memoryPolicy_.hugePageMode_);
+        for (auto offset = 0ull; offset < mappedSize; offset += pageSize)
+            reinterpret_cast<char volatile *>(address)[offset] = 0;
+    }
+
+    if ((memoryPolicy_.lock_) && (::mlock(address, mappedSize) != 0))
+    {
+        ::munmap(address, mappedSize);
+        throw std::bad_alloc();
+    }
+    return reinterpret_cast<T *>(address);
+}
+
+
+//=============================================================================
+template <typename T>
+void lime::numa_allocator<T>::deallocate
+(
+    T * address,
+    std::size_t count
+)
+{
+    ::munmap(address, get_mapped_size(count));
+}
@@ -0,0 +1,504 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./price_level_book.h"
+#include <include/non_copyable.h>
+#include <include/type_rich.h>
+#include <include/bit.h>
+
+#include <algorithm>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+
+namespace lime
+{
+
+    using order_id = type_rich<struct order_id_tag, std::uint64_t>;
+
+
+    //=========================================================================
+    // L3 (order by order) book for a single symbol.  orders live in a slab allocated at
+    // construction and are found by id through an open addressing table (linear probing with
+    // backward shift deletion so there are no tombstones).  each price level keeps an
+    // intrusive FIFO of its orders (time priority) in the level data of the L2 book which
+    // the order book keeps current, so the L2 view is available at no extra cost.
+    //
+    // orders are never allocated after construction.  levels outside of the L2 book's tick
+    // window use its map fallback which does allocate (as does a recenter which moves levels
+    // across the edge of the window).  levels within the window, including those shifted by
+    // a recenter, never allocate.
+    template <fixed_price_concept P = fixed_price<4>, std::unsigned_integral S = std::uint64_t, type_rich_concept I = order_id>
+    requires std::unsigned_integral<typename I::value_type>
+    class order_book :
+        non_copyable
+    {
+    public:
+
+        using price_type = P;
+        using shares_type = shares<S>;
+        using order_id_type = I;
+
+        static auto constexpr default_window_size = std::size_t(4096);
+
+        struct order
+        {
+            order_id_type           id_;
+            price_type              price_;
+            shares_type             shares_;
+            lime::quotation_type    side_;
+
+        private:
+
+            friend class order_book;
+
+            std::uint32_t           previous_;
+            std::uint32_t           next_;
+        };
+
+        order_book
+        (
+            price_type,
+            std::size_t,
+            std::size_t = default_window_size
+        );
+
+        order_book(order_book &&) = default;
+        order_book & operator = (order_book &&) = default;
+        ~order_book() = default;
+
+        // returns false if the id is in use, the book is full or shares is zero
+        bool add
+        (
+            order_id_type,
+            lime::quotation_type,
+            price_type,
+            shares_type
+        );
+
+        // executions and partial cancels.  the order keeps its priority and is removed once
+        // it has no shares left.  returns false if the order does not exist.
+        bool reduce
+        (
+            order_id_type,
+            shares_type
+        );
+
+        bool remove
+        (
+            order_id_type
+        );
+
+        // replaces an order with a new order (new id, price and shares) on the same side.
+        // the new order loses priority.  returns false if the original order does not exist,
+        // the new id is in use or shares is zero (in which case the original is unchanged).
+        bool replace
+        (
+            order_id_type,
+            order_id_type,
+            price_type,
+            shares_type
+        );
+
+        order const * find
+        (
+            order_id_type
+        ) const;
+
+        // invokes the function with each order at the price in priority order
+        template <typename F>
+        std::size_t for_each_order
+        (
+            lime::quotation_type,
+            price_type,
+            F &&
+        ) const;
+
+        auto const & get_levels() const;
+
+        std::size_t size() const;
+
+        std::size_t capacity() const;
+
+        void clear();
+
+    private:
+
+        using key_type = typename order_id_type::value_type;
+        static auto constexpr no_index = ~std::uint32_t(0);
+
+        struct order_queue
+        {
+            std::uint32_t   head_{no_index};
+            std::uint32_t   tail_{no_index};
+        };
+
+        struct entry
+        {
+            key_type        key_;
+            std::uint32_t   index_{no_index};
+        };
+
+        std::size_t get_home
+        (
+            key_type
+        ) const;
+
+        std::size_t find_entry
+        (
+            key_type
+        ) const;
+
+        void erase_entry
+        (
+            std::size_t
+        );
+
+        void remove_order
+        (
+            std::uint32_t
+        );
+
+        price_level_book<P, S, order_queue>     levels_;
+
+        std::vector<order>                      orders_;
+
+        std::uint32_t                           freeHead_{no_index};
+
+        std::vector<entry>                      entries_;
+
+        std::size_t                             entryMask_;
+
+        std::uint32_t                           entryShift_;
+
+        std::size_t                             size_{0};
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+lime::order_book<P, S, I>::order_book
+(
+    // the id table is kept at most half full
+    price_type tickSize,
+    std::size_t capacity,
+    std::size_t windowSize
+):
+    levels_(tickSize, windowSize),
+    orders_(std::clamp<std::size_t>(capacity, 1, no_index - 1)),
+    entries_(minimum_power_of_two(orders_.size() * 2)),
+    entryMask_(entries_.size() - 1),
+    entryShift_(64 - std::countr_zero(entries_.size()))
+{
+    clear();
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::order_book<P, S, I>::get_home
+(
+    // fibonacci hashing.  exchange order ids are often sequential which this spreads
+    key_type key
+) const -> std::size_t
+{
+    return ((std::uint64_t(key) * 0x9e3779b97f4a7c15ull) >> entryShift_) & entryMask_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::order_book<P, S, I>::find_entry
+(
+    // the entry holding the key or the empty entry which ends its probe sequence
+    key_type key
+) const -> std::size_t
+{
+    auto position = get_home(key);
+    while ((entries_[position].index_ != no_index) && (entries_[position].key_ != key))
+        position = ((position + 1) & entryMask_);
+    return position;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+void lime::order_book<P, S, I>::erase_entry
+(
+    // backward shift deletion: later entries of the cluster which may live in the hole
+    // (their home is not cyclically within (hole, position]) are moved back into it
+    std::size_t hole
+)
+{
+    for (auto position = ((hole + 1) & entryMask_); entries_[position].index_ != no_index; position = ((position + 1) & entryMask_))
+    {
+        auto home = get_home(entries_[position].key_);
+        if (((position - home) & entryMask_) >= ((position - hole) & entryMask_))
+        {
+            entries_[hole] = entries_[position];
+            hole = position;
+        }
+    }
+    entries_[hole].index_ = no_index;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+bool lime::order_book<P, S, I>::add
+(
+    order_id_type id,
+    lime::quotation_type side,
+    price_type price,
+    shares_type shares
+)
+{
+    // a level lives while it has shares so an order without shares could be left queued
+    // on a level which has been erased
+    if (shares.get() == 0)
+        return false;
+    auto position = find_entry(id.get());
+    if ((entries_[position].index_ != no_index) || (freeHead_ == no_index))
+        return false;
+
+    auto index = freeHead_;
+    auto & order = orders_[index];
+    freeHead_ = order.next_;
+    auto & queue = levels_.add(side, price, shares, 1);
+    order.id_ = id;
+    order.price_ = price;
+    order.shares_ = shares;
+    order.side_ = side;
+    order.previous_ = queue.tail_;
+    order.next_ = no_index;
+    if (queue.tail_ == no_index)
+        queue.head_ = index;
+    else
+        orders_[queue.tail_].next_ = index;
+    queue.tail_ = index;
+
+    entries_[position] = {id.get(), index};
+    ++size_;
+    return true;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+void lime::order_book<P, S, I>::remove_order
+(
+    // unlinks the order from its level's queue (before the level can be erased by the
+    // removal of its shares) and returns it to the free list
+    std::uint32_t index
+)
+{
+    auto & order = orders_[index];
+    auto queue = levels_.find_level_data(order.side_, order.price_);
+    assert(queue != nullptr);
+    if (order.previous_ == no_index)
+        queue->head_ = order.next_;
+    else
+        orders_[order.previous_].next_ = order.next_;
+    if (order.next_ == no_index)
+        queue->tail_ = order.previous_;
+    else
+        orders_[order.next_].previous_ = order.previous_;
+    levels_.remove(order.side_, order.price_, order.shares_, 1);
+
+    order.next_ = freeHead_;
+    freeHead_ = index;
+    --size_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+bool lime::order_book<P, S, I>::reduce
+(
+    order_id_type id,
+    shares_type shares
+)
+{
+    auto position = find_entry(id.get());
+    auto index = entries_[position].index_;
+    if (index == no_index)
+        return false;
+    auto & order = orders_[index];
+    if (shares.get() >= order.shares_.get())
+    {
+        remove_order(index);
+        erase_entry(position);
+        return true;
+    }
+    order.shares_ -= shares;
+    levels_.remove(order.side_, order.price_, shares, 0);
+    return true;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+bool lime::order_book<P, S, I>::remove
+(
+    order_id_type id
+)
+{
+    auto position = find_entry(id.get());
+    auto index = entries_[position].index_;
+    if (index == no_index)
+        return false;
+    remove_order(index);
+    erase_entry(position);
+    return true;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+bool lime::order_book<P, S, I>::replace
+(
+    order_id_type id,
+    order_id_type newId,
+    price_type price,
+    shares_type shares
+)
+{
+    auto position = find_entry(id.get());
+    auto index = entries_[position].index_;
+    if ((index == no_index) || (shares.get() == 0) || ((newId != id) && (entries_[find_entry(newId.get())].index_ != no_index)))
+        return false;
+    auto side = orders_[index].side_;
+    remove_order(index);
+    erase_entry(position);
+    return add(newId, side, price, shares);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::order_book<P, S, I>::find
+(
+    // nullptr if there is no such order
+    order_id_type id
+) const -> order const *
+{
+    auto index = entries_[find_entry(id.get())].index_;
+    return (index == no_index) ? nullptr : &orders_[index];
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+template <typename F>
+inline auto lime::order_book<P, S, I>::for_each_order
+(
+    lime::quotation_type side,
+    price_type price,
+    F && function
+) const -> std::size_t
+{
+    auto const * queue = ((side == lime::quotation_type::bid) ? levels_.get_bids().find_level_data(price) : levels_.get_asks().find_level_data(price));
+    if (queue == nullptr)
+        return 0;
+    auto count = std::size_t(0);
+    for (auto index = queue->head_; index != no_index; index = orders_[index].next_, ++count)
+        function(orders_[index]);
+    return count;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto const & lime::order_book<P, S, I>::get_levels
+(
+    // the L2 view
+) const
+{
+    return levels_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::order_book<P, S, I>::size
+(
+) const -> std::size_t
+{
+    return size_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::order_book<P, S, I>::capacity
+(
+) const -> std::size_t
+{
+    return orders_.size();
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+void lime::order_book<P, S, I>::clear
+(
+)
+{
+    levels_.clear();
+    for (auto & entry : entries_)
+        entry.index_ = no_index;
+    for (auto index = std::uint32_t(0); index < orders_.size(); ++index)
+        orders_[index].next_ = (index + 1);
+    orders_.back().next_ = no_index;
+    freeHead_ = 0;
+    size_ = 0;
+}
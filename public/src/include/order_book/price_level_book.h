@@ -0,0 +1,1080 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/quotation.h>
+#include <include/bit.h>
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    template <fixed_price_concept P, std::unsigned_integral S>
+    struct price_level
+    {
+        P               price_;
+        shares<S>       shares_;
+        std::uint32_t   orderCount_;
+    };
+
+
+    //=========================================================================
+    // the default per level data: none
+    struct empty_level_data
+    {
+    };
+
+
+    //=========================================================================
+    // one side of an L2 book.  prices on the tick grid within a window of ticks around the
+    // touch map directly to a slot in a flat array and a two level bitmap of occupied slots
+    // finds the next level when the best is removed.  prices outside of the window (or off
+    // the tick grid) are kept in a std::map.  the window is recentered when the touch moves
+    // out of it.  levels which stay within the window are shifted in place and only those
+    // crossing its edge move between the array and the map.
+    //
+    // each level may carry data of type D (default constructed when the level is created)
+    // which is how an order book keeps its per level order queues in the same levels.
+    template <quotation_type Q, fixed_price_concept P = fixed_price<4>, std::unsigned_integral S = std::uint64_t, typename D = empty_level_data>
+    requires ((Q == quotation_type::bid) || (Q == quotation_type::ask))
+    class price_level_book_side
+    {
+    public:
+
+        static auto constexpr quotation_type = Q;
+        using price_type = P;
+        using shares_type = shares<S>;
+        using level_type = price_level<P, S>;
+        using level_data_type = D;
+
+        price_level_book_side
+        (
+            price_type,
+            std::size_t
+        );
+
+        price_level_book_side(price_level_book_side const &) = default;
+        price_level_book_side & operator = (price_level_book_side const &) = default;
+        price_level_book_side(price_level_book_side &&) = default;
+        price_level_book_side & operator = (price_level_book_side &&) = default;
+        ~price_level_book_side() = default;
+
+        // adds shares (and orders) to the level at price, creating the level if need be.
+        // returns the level's data which remains valid until the side is next modified.
+        level_data_type & add
+        (
+            price_type,
+            shares_type,
+            std::uint32_t = 1
+        );
+
+        // removes shares (and orders) from the level at price.  the level is deleted once it
+        // holds no shares.  returns false if there is no level at price.
+        bool remove
+        (
+            price_type,
+            shares_type,
+            std::uint32_t = 1
+        );
+
+        // replaces the level at price.  zero shares deletes the level.
+        void set
+        (
+            price_type,
+            shares_type,
+            std::uint32_t
+        );
+
+        bool erase
+        (
+            price_type
+        );
+
+        level_type get_level
+        (
+            price_type
+        ) const;
+
+        level_data_type * find_level_data
+        (
+            price_type
+        );
+
+        level_data_type const * find_level_data
+        (
+            price_type
+        ) const;
+
+        std::optional<level_type> get_best() const;
+
+        // invokes the function with each level, best first, up to the maximum number
+        // of levels.  returns the number of levels visited.
+        template <typename F>
+        std::size_t for_each_level
+        (
+            std::size_t,
+            F &&
+        ) const;
+
+        std::size_t get_level_count() const;
+
+        std::uint64_t get_recenter_count() const;
+
+        void clear();
+
+    private:
+
+        using value_type = typename price_type::value_type;
+        static auto constexpr is_bid = (Q == quotation_type::bid);
+        static auto constexpr no_index = ~std::size_t(0);
+        static auto constexpr bits_per_word = std::size_t(64);
+
+        struct slot
+        {
+            S                                   shares_{0};
+            std::uint32_t                       orderCount_{0};
+            [[no_unique_address]] D             data_{};
+        };
+
+        // best first for both sides
+        using far_map = std::map<value_type, slot, std::conditional_t<is_bid, std::greater<value_type>, std::less<value_type>>>;
+
+        static bool is_better
+        (
+            value_type,
+            value_type
+        );
+
+        static price_type to_price
+        (
+            value_type
+        );
+
+        std::size_t get_index
+        (
+            value_type
+        ) const;
+
+        value_type get_value
+        (
+            std::size_t
+        ) const;
+
+        slot * find_slot
+        (
+            value_type
+        );
+
+        slot const * find_slot
+        (
+            value_type
+        ) const;
+
+        slot & get_or_insert_slot
+        (
+            value_type
+        );
+
+        void erase_slot
+        (
+            value_type,
+            slot &
+        );
+
+        void set_bit
+        (
+            std::size_t
+        );
+
+        void clear_bit
+        (
+            std::size_t
+        );
+
+        // highest occupied index <= the given index or no_index
+        std::size_t find_previous
+        (
+            std::size_t
+        ) const;
+
+        // lowest occupied index >= the given index or no_index
+        std::size_t find_next
+        (
+            std::size_t
+        ) const;
+
+        std::size_t find_worse
+        (
+            std::size_t
+        ) const;
+
+        void recenter
+        (
+            value_type
+        );
+
+        value_type                  tickSize_;
+
+        std::uint64_t               tickReciprocal_;
+
+        std::size_t                 windowSize_;
+
+        value_type                  windowSpan_;
+
+        value_type                  windowBase_{0};
+
+        std::size_t                 best_{no_index};
+
+        std::size_t                 windowLevelCount_{0};
+
+        std::vector<slot>           slots_;
+
+        std::vector<std::uint64_t>  occupied_;
+
+        std::vector<std::uint64_t>  summary_;
+
+        far_map                     far_;
+
+        std::uint64_t               recenterCount_{0};
+    };
+
+
+    //=========================================================================
+    // L2 book for a single symbol
+    template <fixed_price_concept P = fixed_price<4>, std::unsigned_integral S = std::uint64_t, typename D = empty_level_data>
+    class price_level_book
+    {
+    public:
+
+        using price_type = P;
+        using shares_type = shares<S>;
+        using level_type = price_level<P, S>;
+        using level_data_type = D;
+        using bid_side_type = price_level_book_side<quotation_type::bid, P, S, D>;
+        using ask_side_type = price_level_book_side<quotation_type::ask, P, S, D>;
+
+        static auto constexpr default_window_size = std::size_t(4096);
+
+        explicit price_level_book
+        (
+            price_type,
+            std::size_t = default_window_size
+        );
+
+        level_data_type & add
+        (
+            lime::quotation_type,
+            price_type,
+            shares_type,
+            std::uint32_t = 1
+        );
+
+        bool remove
+        (
+            lime::quotation_type,
+            price_type,
+            shares_type,
+            std::uint32_t = 1
+        );
+
+        void set
+        (
+            lime::quotation_type,
+            price_type,
+            shares_type,
+            std::uint32_t
+        );
+
+        bool erase
+        (
+            lime::quotation_type,
+            price_type
+        );
+
+        level_type get_level
+        (
+            lime::quotation_type,
+            price_type
+        ) const;
+
+        level_data_type * find_level_data
+        (
+            lime::quotation_type,
+            price_type
+        );
+
+        std::optional<level_type> get_best_bid() const;
+
+        std::optional<level_type> get_best_ask() const;
+
+        bid_side_type const & get_bids() const;
+
+        ask_side_type const & get_asks() const;
+
+        void clear();
+
+    private:
+
+        bid_side_type   bids_;
+
+        ask_side_type   asks_;
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+lime::price_level_book_side<Q, P, S, D>::price_level_book_side
+(
+    // the window is a power of two number of ticks and spans less than 2^32 in the
+    // underlying price units so that a price maps to its tick with a multiply by the
+    // reciprocal of the tick size rather than a divide.  large ticks can leave fewer
+    // slots than there are bits in a word (but always at least one slot).
+    price_type tickSize,
+    std::size_t windowSize
+):
+    tickSize_(std::max<value_type>(tickSize.get_underlying_value(), 1)),
+    tickReciprocal_((tickSize_ > 1) ? ((~std::uint64_t(0) / tickSize_) + 1) : 0),
+    windowSize_(std::min<std::size_t>(minimum_power_of_two(std::max<std::size_t>(windowSize, bits_per_word * 2)),
+            std::max<std::size_t>(std::bit_floor(std::numeric_limits<std::uint32_t>::max() / std::uint64_t(tickSize_)), 1))),
+    windowSpan_(value_type(windowSize_ * tickSize_)),
+    slots_(windowSize_),
+    occupied_((windowSize_ + bits_per_word - 1) / bits_per_word),
+    summary_((occupied_.size() + bits_per_word - 1) / bits_per_word)
+{
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline bool lime::price_level_book_side<Q, P, S, D>::is_better
+(
+    value_type first,
+    value_type second
+)
+{
+    if constexpr (is_bid)
+        return (first > second);
+    else
+        return (first < second);
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::to_price
+(
+    value_type value
+) -> price_type
+{
+    return price_type(price<value_type>(value, price_type::precision));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::get_index
+(
+    // the window slot for the value or no_index if the value is outside of the window or
+    // not on the tick grid.  the offset is below 2^32 so the product with the rounded up
+    // reciprocal is exact.
+    value_type value
+) const -> std::size_t
+{
+    auto offset = std::uint64_t(value_type(value - windowBase_));
+    if ((value < windowBase_) || (offset >= windowSpan_))
+        return no_index;
+    if (tickSize_ == 1)
+        return offset;
+    auto index = std::uint64_t((static_cast<unsigned __int128>(offset) * tickReciprocal_) >> 64);
+    return ((index * tickSize_) == offset) ? index : no_index;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::get_value
+(
+    std::size_t index
+) const -> value_type
+{
+    return value_type(windowBase_ + (index * tickSize_));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline void lime::price_level_book_side<Q, P, S, D>::set_bit
+(
+    std::size_t index
+)
+{
+    auto word = (index / bits_per_word);
+    occupied_[word] |= (std::uint64_t(1) << (index % bits_per_word));
+    summary_[word / bits_per_word] |= (std::uint64_t(1) << (word % bits_per_word));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline void lime::price_level_book_side<Q, P, S, D>::clear_bit
+(
+    std::size_t index
+)
+{
+    auto word = (index / bits_per_word);
+    occupied_[word] &= ~(std::uint64_t(1) << (index % bits_per_word));
+    if (occupied_[word] == 0)
+        summary_[word / bits_per_word] &= ~(std::uint64_t(1) << (word % bits_per_word));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_previous
+(
+    std::size_t index
+) const -> std::size_t
+{
+    auto word = (index / bits_per_word);
+    if (auto bits = occupied_[word] & (~std::uint64_t(0) >> (bits_per_word - 1 - (index % bits_per_word))); bits != 0)
+        return ((word * bits_per_word) + bits_per_word - 1 - std::countl_zero(bits));
+    if (word-- == 0)
+        return no_index;
+    auto summaryWord = (word / bits_per_word);
+    auto summaryBits = summary_[summaryWord] & (~std::uint64_t(0) >> (bits_per_word - 1 - (word % bits_per_word)));
+    while (summaryBits == 0)
+    {
+        if (summaryWord-- == 0)
+            return no_index;
+        summaryBits = summary_[summaryWord];
+    }
+    word = ((summaryWord * bits_per_word) + bits_per_word - 1 - std::countl_zero(summaryBits));
+    return ((word * bits_per_word) + bits_per_word - 1 - std::countl_zero(occupied_[word]));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_next
+(
+    std::size_t index
+) const -> std::size_t
+{
+    if (index >= windowSize_)
+        return no_index;
+    auto word = (index / bits_per_word);
+    if (auto bits = occupied_[word] & (~std::uint64_t(0) << (index % bits_per_word)); bits != 0)
+        return ((word * bits_per_word) + std::countr_zero(bits));
+    if (++word == occupied_.size())
+        return no_index;
+    auto summaryWord = (word / bits_per_word);
+    auto summaryBits = summary_[summaryWord] & (~std::uint64_t(0) << (word % bits_per_word));
+    while (summaryBits == 0)
+    {
+        if (++summaryWord == summary_.size())
+            return no_index;
+        summaryBits = summary_[summaryWord];
+    }
+    word = ((summaryWord * bits_per_word) + std::countr_zero(summaryBits));
+    return ((word * bits_per_word) + std::countr_zero(occupied_[word]));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_worse
+(
+    // the next occupied index after the given one in best first order
+    std::size_t index
+) const -> std::size_t
+{
+    if constexpr (is_bid)
+        return (index == 0) ? no_index : find_previous(index - 1);
+    else
+        return find_next(index + 1);
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_slot
+(
+    value_type value
+) -> slot *
+{
+    if (auto index = get_index(value); index != no_index)
+        return (occupied_[index / bits_per_word] & (std::uint64_t(1) << (index % bits_per_word))) ? &slots_[index] : nullptr;
+    auto iter = far_.find(value);
+    return (iter == far_.end()) ? nullptr : &iter->second;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_slot
+(
+    value_type value
+) const -> slot const *
+{
+    return const_cast<price_level_book_side *>(this)->find_slot(value);
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+auto lime::price_level_book_side<Q, P, S, D>::get_or_insert_slot
+(
+    // prices outside of the window recenter it if the window is empty, if the price is
+    // better than the window but within a window's span of it (the touch has moved up) or
+    // if the price is worse than the window and the best level has drifted into the worst
+    // quarter of the window (the touch has moved down).  otherwise they go to the map.
+    value_type value
+) -> slot &
+{
+    auto index = get_index(value);
+    if ((index == no_index) && ((value % tickSize_) == 0))
+    {
+        auto windowTop = value_type(windowBase_ + windowSpan_);
+        auto beyondBest = (is_bid ? ((value >= windowTop) && ((value - windowTop) < windowSpan_))
+                : ((value < windowBase_) && ((windowBase_ - value) <= windowSpan_)));
+        auto beyondWorst = (is_bid ? (value < windowBase_) : (value >= windowTop));
+        auto worstQuarter = (is_bid ? (best_ < (windowSize_ / 4)) : (best_ >= (windowSize_ - (windowSize_ / 4))));
+        if ((windowLevelCount_ == 0) || beyondBest)
+            recenter(value);
+        else if (beyondWorst && worstQuarter)
+            recenter(get_value(best_));
+        index = get_index(value);
+    }
+
+    if (index == no_index)
+        return far_[value];
+    if ((occupied_[index / bits_per_word] & (std::uint64_t(1) << (index % bits_per_word))) == 0)
+    {
+        set_bit(index);
+        ++windowLevelCount_;
+        if ((best_ == no_index) || (is_bid ? (index > best_) : (index < best_)))
+            best_ = index;
+    }
+    return slots_[index];
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+void lime::price_level_book_side<Q, P, S, D>::erase_slot
+(
+    value_type value,
+    slot & level
+)
+{
+    auto index = get_index(value);
+    if (index == no_index)
+    {
+        far_.erase(value);
+        return;
+    }
+    level = slot{};
+    clear_bit(index);
+    if (--windowLevelCount_ == 0)
+    {
+        best_ = no_index;
+        if (!far_.empty())
+            recenter(far_.begin()->first);
+    }
+    else if (index == best_)
+    {
+        best_ = find_worse(index);
+    }
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+void lime::price_level_book_side<Q, P, S, D>::recenter
+(
+    // moves the window so that the value is a quarter of the window from its better edge
+    // which leaves room for the touch to improve and three quarters of the window for depth.
+    // levels which remain in the window are shifted in place so only levels which fall off
+    // the edge of the window (or come into it) touch the map.
+    value_type value
+)
+{
+    ++recenterCount_;
+    auto tick = (value / tickSize_);
+    auto offset = std::uint64_t(is_bid ? (windowSize_ - (windowSize_ / 4)) : (windowSize_ / 4));
+    tick = (tick > offset) ? (tick - offset) : 0;
+    tick = std::min<std::uint64_t>(tick, (std::numeric_limits<value_type>::max() - windowSpan_) / tickSize_);
+    auto previousTick = std::uint64_t(windowBase_ / tickSize_);
+
+    // moving the window up shifts levels to lower indices so walk upwards (and downwards
+    // when moving the window down) so that a level never lands on one not yet visited
+    auto move_level = [&](std::size_t index, std::size_t target)
+            {
+                if (target < windowSize_)
+                {
+                    slots_[target] = slots_[index];
+                    set_bit(target);
+                }
+                else
+                {
+                    far_[get_value(index)] = slots_[index];
+                    --windowLevelCount_;
+                }
+            };
+    if (tick > previousTick)
+    {
+        auto shift = (tick - previousTick);
+        for (auto index = find_next(0); index != no_index; index = find_next(index + 1))
+        {
+            clear_bit(index);
+            move_level(index, (index >= shift) ? std::size_t(index - shift) : no_index);
+            slots_[index] = slot{};
+        }
+    }
+    else if (tick < previousTick)
+    {
+        auto shift = (previousTick - tick);
+        for (auto index = find_previous(windowSize_ - 1); index != no_index; index = ((index == 0) ? no_index : find_previous(index - 1)))
+        {
+            clear_bit(index);
+            move_level(index, (shift < (windowSize_ - index)) ? std::size_t(index + shift) : no_index);
+            slots_[index] = slot{};
+        }
+    }
+    windowBase_ = value_type(tick * tickSize_);
+    best_ = no_index;
+
+    auto windowLast = value_type(windowBase_ + windowSpan_ - 1);
+    auto first = (is_bid ? far_.lower_bound(windowLast) : far_.lower_bound(windowBase_));
+    auto last = (is_bid ? far_.upper_bound(windowBase_) : far_.upper_bound(windowLast));
+    while (first != last)
+    {
+        if (auto index = get_index(first->first); index != no_index)
+        {
+            slots_[index] = first->second;
+            set_bit(index);
+            ++windowLevelCount_;
+            first = far_.erase(first);
+        }
+        else
+        {
+            ++first;
+        }
+    }
+    if (windowLevelCount_ > 0)
+        best_ = (is_bid ? find_previous(windowSize_ - 1) : find_next(0));
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::add
+(
+    price_type price,
+    shares_type shares,
+    std::uint32_t orderCount
+) -> level_data_type &
+{
+    auto & level = get_or_insert_slot(price.get_underlying_value());
+    level.shares_ += shares.get();
+    level.orderCount_ += orderCount;
+    return level.data_;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline bool lime::price_level_book_side<Q, P, S, D>::remove
+(
+    price_type price,
+    shares_type shares,
+    std::uint32_t orderCount
+)
+{
+    auto value = price.get_underlying_value();
+    auto level = find_slot(value);
+    if (level == nullptr)
+        return false;
+    level->shares_ -= std::min(level->shares_, shares.get());
+    level->orderCount_ -= std::min(level->orderCount_, orderCount);
+    if (level->shares_ == 0)
+        erase_slot(value, *level);
+    return true;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline void lime::price_level_book_side<Q, P, S, D>::set
+(
+    price_type price,
+    shares_type shares,
+    std::uint32_t orderCount
+)
+{
+    if (shares.get() == 0)
+    {
+        erase(price);
+        return;
+    }
+    auto & level = get_or_insert_slot(price.get_underlying_value());
+    level.shares_ = shares.get();
+    level.orderCount_ = orderCount;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline bool lime::price_level_book_side<Q, P, S, D>::erase
+(
+    price_type price
+)
+{
+    auto value = price.get_underlying_value();
+    auto level = find_slot(value);
+    if (level == nullptr)
+        return false;
+    erase_slot(value, *level);
+    return true;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::get_level
+(
+    // an empty level (zero shares) if there is no level at price
+    price_type price
+) const -> level_type
+{
+    auto level = find_slot(price.get_underlying_value());
+    return (level == nullptr) ? level_type{price, shares_type(0), 0} : level_type{price, shares_type(level->shares_), level->orderCount_};
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_level_data
+(
+    // nullptr if there is no level at price
+    price_type price
+) -> level_data_type *
+{
+    auto level = find_slot(price.get_underlying_value());
+    return (level == nullptr) ? nullptr : &level->data_;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::find_level_data
+(
+    price_type price
+) const -> level_data_type const *
+{
+    auto level = find_slot(price.get_underlying_value());
+    return (level == nullptr) ? nullptr : &level->data_;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::get_best
+(
+    // the better of the window's best and the map's best
+) const -> std::optional<level_type>
+{
+    if (best_ != no_index)
+    {
+        auto value = get_value(best_);
+        if (far_.empty() || !is_better(far_.begin()->first, value))
+            return level_type{to_price(value), shares_type(slots_[best_].shares_), slots_[best_].orderCount_};
+    }
+    if (far_.empty())
+        return std::nullopt;
+    auto const & [value, level] = *far_.begin();
+    return level_type{to_price(value), shares_type(level.shares_), level.orderCount_};
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+template <typename F>
+inline auto lime::price_level_book_side<Q, P, S, D>::for_each_level
+(
+    // merges the window levels and the map levels, both of which are visited best first
+    std::size_t maximumLevelCount,
+    F && function
+) const -> std::size_t
+{
+    auto count = std::size_t(0);
+    auto index = best_;
+    auto iter = far_.begin();
+    while ((count < maximumLevelCount) && ((index != no_index) || (iter != far_.end())))
+    {
+        if ((index != no_index) && ((iter == far_.end()) || is_better(get_value(index), iter->first)))
+        {
+            function(level_type{to_price(get_value(index)), shares_type(slots_[index].shares_), slots_[index].orderCount_});
+            index = find_worse(index);
+        }
+        else
+        {
+            function(level_type{to_price(iter->first), shares_type(iter->second.shares_), iter->second.orderCount_});
+            ++iter;
+        }
+        ++count;
+    }
+    return count;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::get_level_count
+(
+) const -> std::size_t
+{
+    return (windowLevelCount_ + far_.size());
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+inline auto lime::price_level_book_side<Q, P, S, D>::get_recenter_count
+(
+) const -> std::uint64_t
+{
+    return recenterCount_;
+}
+
+
+//=============================================================================
+template <lime::quotation_type Q, lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+requires ((Q == lime::quotation_type::bid) || (Q == lime::quotation_type::ask))
+void lime::price_level_book_side<Q, P, S, D>::clear
+(
+)
+{
+    for (auto index = find_next(0); index != no_index; index = find_next(index + 1))
+        slots_[index] = slot{};
+    std::fill(occupied_.begin(), occupied_.end(), 0);
+    std::fill(summary_.begin(), summary_.end(), 0);
+    far_.clear();
+    windowLevelCount_ = 0;
+    best_ = no_index;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+lime::price_level_book<P, S, D>::price_level_book
+(
+    price_type tickSize,
+    std::size_t windowSize
+):
+    bids_(tickSize, windowSize),
+    asks_(tickSize, windowSize)
+{
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::add
+(
+    lime::quotation_type side,
+    price_type price,
+    shares_type shares,
+    std::uint32_t orderCount
+) -> level_data_type &
+{
+    if (side == lime::quotation_type::bid)
+        return bids_.add(price, shares, orderCount);
+    return asks_.add(price, shares, orderCount);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline bool lime::price_level_book<P, S, D>::remove
+(
+    lime::quotation_type side,
+    price_type price,
+    shares_type shares,
+    std::uint32_t orderCount
+)
+{
+    return (side == lime::quotation_type::bid) ? bids_.remove(price, shares, orderCount) : asks_.remove(price, shares, orderCount);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline void lime::price_level_book<P, S, D>::set
+(
+    lime::quotation_type side,
+    price_type price,
+    shares_type shares,
+    std::uint32_t orderCount
+)
+{
+    if (side == lime::quotation_type::bid)
+        bids_.set(price, shares, orderCount);
+    else
+        asks_.set(price, shares, orderCount);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline bool lime::price_level_book<P, S, D>::erase
+(
+    lime::quotation_type side,
+    price_type price
+)
+{
+    return (side == lime::quotation_type::bid) ? bids_.erase(price) : asks_.erase(price);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::get_level
+(
+    lime::quotation_type side,
+    price_type price
+) const -> level_type
+{
+    return (side == lime::quotation_type::bid) ? bids_.get_level(price) : asks_.get_level(price);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::find_level_data
+(
+    lime::quotation_type side,
+    price_type price
+) -> level_data_type *
+{
+    return (side == lime::quotation_type::bid) ? bids_.find_level_data(price) : asks_.find_level_data(price);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::get_best_bid
+(
+) const -> std::optional<level_type>
+{
+    return bids_.get_best();
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::get_best_ask
+(
+) const -> std::optional<level_type>
+{
+    return asks_.get_best();
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::get_bids
+(
+) const -> bid_side_type const &
+{
+    return bids_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+inline auto lime::price_level_book<P, S, D>::get_asks
+(
+) const -> ask_side_type const &
+{
+    return asks_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, std::unsigned_integral S, typename D>
+void lime::price_level_book<P, S, D>::clear
+(
+)
+{
+    bids_.clear();
+    asks_.clear();
+}
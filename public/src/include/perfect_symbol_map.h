@@ -0,0 +1,554 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./non_copyable.h"
+#include "./symbol_name.h"
+#include "./symbol_directory.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // a read only map from a fixed set of symbols (the day's universe) to their index in
+    // the list it was built from.  built once using hash and displace: keys are hashed into
+    // buckets of about four and, largest bucket first, each bucket searches for a pilot value
+    // which moves all of its keys into unused slots.  there is exactly one slot per key
+    // (minimal) and a lookup reads the bucket's pilot and then the one candidate slot.
+    //
+    // the map is a single contiguous image (header, pilots, slots) so it can be saved to a
+    // file and later mapped read only by load() which avoids rebuilding on restart.
+    template <symbol_name_concept S, type_rich_concept I = symbol_id>
+    requires std::unsigned_integral<typename I::value_type>
+    class perfect_symbol_map : non_copyable
+    {
+    public:
+
+        using symbol_type = S;
+        using id_type = I;
+
+        static std::optional<perfect_symbol_map> build
+        (
+            std::span<symbol_type const>
+        );
+
+        static std::optional<perfect_symbol_map> load
+        (
+            std::string const &
+        );
+
+        perfect_symbol_map(perfect_symbol_map &&);
+        perfect_symbol_map & operator = (perfect_symbol_map &&);
+        ~perfect_symbol_map();
+
+        bool save
+        (
+            std::string const &
+        ) const;
+
+        std::optional<id_type> find
+        (
+            symbol_type const &
+        ) const;
+
+        std::size_t size() const;
+
+    private:
+
+        static auto constexpr magic = std::uint64_t(0x6c696d6570686d70); // "limephmp"
+        static auto constexpr version = std::uint32_t(1);
+        static auto constexpr average_bucket_size = 4;
+        static auto constexpr maximum_pilot = std::uint32_t(1) << 24;
+        static auto constexpr maximum_seed_attempts = 16;
+
+        struct header
+        {
+            std::uint64_t   magic_;
+            std::uint32_t   version_;
+            std::uint32_t   symbolSize_;
+            std::uint32_t   count_;
+            std::uint32_t   bucketCount_;
+            std::uint64_t   seed_;
+            char            fill_;
+            char            reserved_[7];
+        };
+
+        #pragma pack(push, 1)
+        struct slot
+        {
+            symbol_type     symbol_;
+            std::uint32_t   id_;
+        };
+        #pragma pack(pop)
+
+        static std::size_t get_image_size
+        (
+            std::size_t,
+            std::size_t
+        );
+
+        static std::uint64_t reduce
+        (
+            std::uint64_t,
+            std::uint64_t
+        );
+
+        static std::uint64_t get_slot_hash
+        (
+            std::uint64_t,
+            std::uint32_t
+        );
+
+        static bool try_build
+        (
+            std::span<symbol_type const>,
+            std::uint64_t,
+            std::vector<std::byte> &
+        );
+
+        perfect_symbol_map
+        (
+            std::vector<std::byte>
+        );
+
+        perfect_symbol_map
+        (
+            void const *,
+            std::size_t
+        );
+
+        void attach();
+
+        void release();
+
+        std::vector<std::byte>      image_;
+        void const *                mappedAddress_{nullptr};
+        std::size_t                 mappedSize_{0};
+
+        header const *              header_{nullptr};
+        std::uint32_t const *       pilots_{nullptr};
+        slot const *                slots_{nullptr};
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+lime::perfect_symbol_map<S, I>::perfect_symbol_map
+(
+    std::vector<std::byte> image
+):
+    image_(std::move(image))
+{
+    attach();
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+lime::perfect_symbol_map<S, I>::perfect_symbol_map
+(
+    void const * mappedAddress,
+    std::size_t mappedSize
+):
+    mappedAddress_(mappedAddress),
+    mappedSize_(mappedSize)
+{
+    attach();
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+lime::perfect_symbol_map<S, I>::perfect_symbol_map
+(
+    perfect_symbol_map && other
+):
+    image_(std::move(other.image_)),
+    mappedAddress_(std::exchange(other.mappedAddress_, nullptr)),
+    mappedSize_(std::exchange(other.mappedSize_, 0))
+{
+    attach();
+    other.header_ = nullptr;
+    other.pilots_ = nullptr;
+    other.slots_ = nullptr;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+auto lime::perfect_symbol_map<S, I>::operator =
+(
+    perfect_symbol_map && other
+) -> perfect_symbol_map &
+{
+    if (this != &other)
+    {
+        release();
+        image_ = std::move(other.image_);
+        mappedAddress_ = std::exchange(other.mappedAddress_, nullptr);
+        mappedSize_ = std::exchange(other.mappedSize_, 0);
+        attach();
+        other.header_ = nullptr;
+        other.pilots_ = nullptr;
+        other.slots_ = nullptr;
+    }
+    return *this;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+lime::perfect_symbol_map<S, I>::~perfect_symbol_map
+(
+)
+{
+    release();
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+void lime::perfect_symbol_map<S, I>::release
+(
+)
+{
+    if (mappedAddress_ != nullptr)
+        ::munmap(const_cast<void *>(mappedAddress_), mappedSize_);
+    mappedAddress_ = nullptr;
+    mappedSize_ = 0;
+    image_.clear();
+    header_ = nullptr;
+    pilots_ = nullptr;
+    slots_ = nullptr;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+void lime::perfect_symbol_map<S, I>::attach
+(
+)
+{
+    auto address = (mappedAddress_ != nullptr) ? reinterpret_cast<std::byte const *>(mappedAddress_) : image_.data();
+    if (address == nullptr)
+        return;
+    header_ = reinterpret_cast<header const *>(address);
+    pilots_ = reinterpret_cast<std::uint32_t const *>(address + sizeof(header));
+    slots_ = reinterpret_cast<slot const *>(address + sizeof(header) + (sizeof(std::uint32_t) * header_->bucketCount_));
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::perfect_symbol_map<S, I>::get_image_size
+(
+    std::size_t count,
+    std::size_t bucketCount
+) -> std::size_t
+{
+    return (sizeof(header) + (sizeof(std::uint32_t) * bucketCount) + (sizeof(slot) * count));
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::perfect_symbol_map<S, I>::reduce
+(
+    // maps a 64 bit hash onto [0, range) with a multiply rather than a modulo
+    std::uint64_t hash,
+    std::uint64_t range
+) -> std::uint64_t
+{
+    return static_cast<std::uint64_t>((static_cast<unsigned __int128>(hash) * range) >> 64);
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::perfect_symbol_map<S, I>::get_slot_hash
+(
+    std::uint64_t hash,
+    std::uint32_t pilot
+) -> std::uint64_t
+{
+    hash ^= ((pilot + 1) * 0x9e3779b97f4a7c15ull);
+    hash ^= (hash >> 33);
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= (hash >> 33);
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= (hash >> 33);
+    return hash;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+auto lime::perfect_symbol_map<S, I>::build
+(
+    // fails if the symbols contain duplicates or there are more than the id type can represent
+    std::span<symbol_type const> symbols
+) -> std::optional<perfect_symbol_map>
+{
+    if ((symbols.size() > std::numeric_limits<std::uint32_t>::max()) ||
+            (symbols.size() > (std::size_t(std::numeric_limits<typename I::value_type>::max()) + 1)))
+        return std::nullopt;
+
+    std::vector<std::byte> image;
+    for (auto attempt = 0; attempt < maximum_seed_attempts; ++attempt)
+    {
+        auto result = try_build(symbols, attempt, image);
+        if (!result)
+            return std::nullopt;
+        if (!image.empty())
+            return perfect_symbol_map(std::move(image));
+    }
+    return std::nullopt;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+bool lime::perfect_symbol_map<S, I>::try_build
+(
+    // returns false if the symbols can never be placed (duplicates).  otherwise an
+    // empty image means that this seed failed and another should be tried.
+    std::span<symbol_type const> symbols,
+    std::uint64_t seed,
+    std::vector<std::byte> & image
+)
+{
+    image.clear();
+    auto count = symbols.size();
+    auto bucketCount = std::max<std::size_t>((count + average_bucket_size - 1) / average_bucket_size, 1);
+
+    std::vector<std::uint64_t> hashes(count);
+    std::vector<std::uint32_t> order(count);
+    std::vector<std::uint32_t> bucketOf(count);
+    for (auto i = 0ull; i < count; ++i)
+    {
+        hashes[i] = symbols[i].hash(seed);
+        bucketOf[i] = reduce(hashes[i], bucketCount);
+    }
+
+    // group keys by bucket, largest buckets first
+    std::vector<std::uint32_t> bucketSize(bucketCount, 0);
+    for (auto bucket : bucketOf)
+        ++bucketSize[bucket];
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](auto a, auto b)
+            {
+                if (bucketSize[bucketOf[a]] != bucketSize[bucketOf[b]])
+                    return (bucketSize[bucketOf[a]] > bucketSize[bucketOf[b]]);
+                if (bucketOf[a] != bucketOf[b])
+                    return (bucketOf[a] < bucketOf[b]);
+                return (hashes[a] < hashes[b]);
+            });
+
+    image.resize(get_image_size(count, bucketCount));
+    auto pilots = reinterpret_cast<std::uint32_t *>(image.data() + sizeof(header));
+    auto slots = reinterpret_cast<slot *>(image.data() + sizeof(header) + (sizeof(std::uint32_t) * bucketCount));
+    std::fill_n(pilots, bucketCount, 0);
+
+    std::vector<bool> taken(count, false);
+    std::vector<std::uint64_t> candidates;
+    for (auto begin = 0ull; begin < count; )
+    {
+        auto bucket = bucketOf[order[begin]];
+        auto end = begin + bucketSize[bucket];
+
+        // identical hashes within a bucket can never be separated by a pilot
+        for (auto i = begin + 1; i < end; ++i)
+        {
+            if (hashes[order[i]] == hashes[order[i - 1]])
+            {
+                image.clear();
+                return (symbols[order[i]] != symbols[order[i - 1]]);
+            }
+        }
+
+        auto placed = false;
+        for (auto pilot = std::uint32_t(0); ((!placed) && (pilot < maximum_pilot)); ++pilot)
+        {
+            candidates.clear();
+            for (auto i = begin; i < end; ++i)
+            {
+                auto candidate = reduce(get_slot_hash(hashes[order[i]], pilot), count);
+                if ((taken[candidate]) || (std::find(candidates.begin(), candidates.end(), candidate) != candidates.end()))
+                    break;
+                candidates.push_back(candidate);
+            }
+            if (candidates.size() != (end - begin))
+                continue;
+            for (auto i = begin; i < end; ++i)
+            {
+                taken[candidates[i - begin]] = true;
+                slots[candidates[i - begin]] = {symbols[order[i]], order[i]};
+            }
+            pilots[bucket] = pilot;
+            placed = true;
+        }
+        if (!placed)
+        {
+            image.clear();
+            return true;
+        }
+        begin = end;
+    }
+
+    header h{};
+    h.magic_ = magic;
+    h.version_ = version;
+    h.symbolSize_ = sizeof(symbol_type);
+    h.count_ = count;
+    h.bucketCount_ = bucketCount;
+    h.seed_ = seed;
+    h.fill_ = symbol_type::fill;
+    std::memcpy(image.data(), &h, sizeof(h));
+    return true;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+bool lime::perfect_symbol_map<S, I>::save
+(
+    std::string const & path
+) const
+{
+    if (header_ == nullptr)
+        return false;
+    std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<char const *>(header_), get_image_size(header_->count_, header_->bucketCount_));
+    stream.close();
+    return stream.good();
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+auto lime::perfect_symbol_map<S, I>::load
+(
+    // maps a file written by save().  fails if the file is not a map of this symbol type.
+    std::string const & path
+) -> std::optional<perfect_symbol_map>
+{
+    auto fileDescriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fileDescriptor < 0)
+        return std::nullopt;
+
+    struct stat status;
+    if ((::fstat(fileDescriptor, &status) != 0) || (std::size_t(status.st_size) < sizeof(header)))
+    {
+        ::close(fileDescriptor);
+        return std::nullopt;
+    }
+
+    auto mappedSize = std::size_t(status.st_size);
+    auto address = ::mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE | MAP_POPULATE, fileDescriptor, 0);
+    ::close(fileDescriptor);
+    if (address == MAP_FAILED)
+        return std::nullopt;
+
+    auto const & h = *reinterpret_cast<header const *>(address);
+    if ((h.magic_ != magic) || (h.version_ != version) || (h.symbolSize_ != sizeof(symbol_type)) ||
+            (h.fill_ != symbol_type::fill) || (h.bucketCount_ == 0) ||
+            (std::size_t(h.count_) > (std::size_t(std::numeric_limits<typename I::value_type>::max()) + 1)) ||
+            (get_image_size(h.count_, h.bucketCount_) != mappedSize))
+    {
+        ::munmap(address, mappedSize);
+        return std::nullopt;
+    }
+    return perfect_symbol_map(address, mappedSize);
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::perfect_symbol_map<S, I>::find
+(
+    symbol_type const & symbol
+) const -> std::optional<id_type>
+{
+    if ((header_ == nullptr) || (header_->count_ == 0))
+        return std::nullopt;
+    auto hash = symbol.hash(header_->seed_);
+    auto pilot = pilots_[reduce(hash, header_->bucketCount_)];
+    auto const & candidate = slots_[reduce(get_slot_hash(hash, pilot), header_->count_)];
+    if (candidate.symbol_ != symbol)
+        return std::nullopt;
+    return id_type(candidate.id_);
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::perfect_symbol_map<S, I>::size
+(
+) const -> std::size_t
+{
+    return (header_ == nullptr) ? 0 : header_->count_;
+}
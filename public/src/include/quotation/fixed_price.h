@@ -50,6 +50,7 @@ namespace lime
 
         using value_type = T;
         static auto constexpr precision = N;
+        static auto constexpr scale = T(pow_10_v<N>);
 
         constexpr fixed_price() = default;
         constexpr fixed_price(fixed_price_concept auto const &);
@@ -113,6 +114,14 @@ namespace lime
 
         template <std::uint32_t, std::unsigned_integral> friend class fixed_price;
 
+        // rescales a value of precision N_ to precision N.  the scale factor is a constant
+        // so the compiler folds it (and any division by it) into multiplies.
+        template <std::uint32_t N_>
+        static constexpr value_type rescale
+        (
+            std::unsigned_integral auto
+        );
+
         value_type value_;
     };
     #pragma pack(pop)
@@ -130,6 +139,19 @@ namespace lime
     }    
 
 
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars
+    (
+        char * first,
+        char * last,
+        fixed_price_concept auto price
+    )
+    {
+        return to_chars_fixed_point(first, last, price.get_underlying_value(), price.get_precision());
+    }
+
+
     //=========================================================================
     [[__maybe_unused__]]
     static std::string to_string
@@ -137,15 +159,9 @@ namespace lime
         fixed_price_concept auto price
     )
     {
-        auto s = std::to_string(price.get_underlying_value());
-        while (s.size() <= price.get_precision())
-            s = '0' + s;
-        s.resize(s.size() + 1);
-        auto beg = s.size() - 1;
-        auto end = (beg - price.get_precision());
-        for (auto i = beg; i >= end; --i)
-            s[i] = (i == end) ? '.' : s[i - 1];
-        return s;
+        std::array<char, 2 + std::numeric_limits<decltype(price.get_underlying_value())>::digits10 + price.get_precision()> buffer;
+        auto [end, _] = to_chars(buffer.data(), buffer.data() + buffer.size(), price);
+        return std::string(buffer.data(), end);
     }
 
 } // namespace lime
@@ -158,15 +174,7 @@ constexpr lime::fixed_price<N, T>::fixed_price
     fixed_price_concept auto const & other
 )
 {
-    auto value = other.value_;
-    if constexpr (get_precision() != other.get_precision())
-    {
-        if (get_precision() < other.get_precision())
-            value /= pow_10(other.get_precision() - get_precision());
-        else
-            value *= pow_10(get_precision() - other.get_precision());
-    }
-    value_ = value;
+    value_ = rescale<std::decay_t<decltype(other)>::precision>(other.value_);
 }
 
 
@@ -178,13 +186,10 @@ constexpr lime::fixed_price<N, T>::fixed_price
 )
 {
     auto value = other.get_underlying_value();
-    if (get_precision() != other.get_precision())
-    {
-        if (get_precision() < other.get_precision())
-            value /= pow_10(other.get_precision() - get_precision());
-        else
-            value *= pow_10(get_precision() - other.get_precision());
-    }
+    if (get_precision() < other.get_precision())
+        value = divide_by_pow_10(value, other.get_precision() - get_precision());
+    else if (get_precision() > other.get_precision())
+        value *= pow_10(get_precision() - other.get_precision());
     value_ = value;
 }
 
@@ -196,15 +201,7 @@ constexpr auto lime::fixed_price<N, T>::operator =
     fixed_price_concept auto const & other
 ) -> fixed_price &
 {
-    auto value = other.value_;
-    if constexpr (get_precision() != other.get_precision())
-    {
-        if (get_precision() < other.get_precision())
-            value /= pow_10(other.get_precision() - get_precision());
-        else
-            value *= pow_10(get_precision() - other.get_precision());
-    }
-    value_ = value;
+    value_ = rescale<std::decay_t<decltype(other)>::precision>(other.value_);
     return *this;
 }
 
@@ -216,15 +213,7 @@ constexpr lime::fixed_price<N, T>::fixed_price
     fixed_price_concept auto && other
 )
 {
-    auto value = other.value_;
-    if constexpr (get_precision() != other.get_precision())
-    {
-        if (get_precision() < other.get_precision())
-            value /= pow_10(other.get_precision() - get_precision());
-        else
-            value *= pow_10(get_precision() - other.get_precision());
-    }
-    value_ = value;
+    value_ = rescale<std::decay_t<decltype(other)>::precision>(other.value_);
 }
 
 
@@ -235,15 +224,7 @@ constexpr auto lime::fixed_price<N, T>::operator =
     fixed_price_concept auto && other
 ) -> fixed_price &
 {
-    auto value = other.value_;
-    if constexpr (get_precision() != other.get_precision())
-    {
-        if (get_precision() < other.get_precision())
-            value /= pow_10(other.get_precision() - get_precision());
-        else
-            value *= pow_10(get_precision() - other.get_precision());
-    }
-    value_ = value;
+    value_ = rescale<std::decay_t<decltype(other)>::precision>(other.value_);
     return *this;
 }
 
@@ -254,11 +235,28 @@ constexpr lime::fixed_price<N, T>::fixed_price
 (
     numeric_concept auto value
 ):
-    value_(value * pow_10(precision))
+    value_(value * scale)
 {
 }
 
 
+//=============================================================================
+template <std::uint32_t N, std::unsigned_integral T>
+template <std::uint32_t N_>
+constexpr auto lime::fixed_price<N, T>::rescale
+(
+    std::unsigned_integral auto value
+) -> value_type
+{
+    if constexpr (N_ > N)
+        return value_type(value / pow_10_v<N_ - N>);
+    else if constexpr (N_ < N)
+        return value_type(value * pow_10_v<N - N_>);
+    else
+        return value_type(value);
+}
+
+
 //=============================================================================
 template <std::uint32_t N, std::unsigned_integral T>
 template <std::floating_point T_>
@@ -266,7 +264,7 @@ constexpr lime::fixed_price<N, T>::operator T_
 (
 ) const
 {
-    return ((T_)value_ / pow_10(precision));
+    return ((T_)value_ / scale);
 }
 
 
@@ -297,12 +295,13 @@ constexpr inline auto lime::fixed_price<N, T>::operator <=>
     fixed_price_concept auto const & other
 ) const
 {
-    if constexpr (get_precision() == other.get_precision())
+    using other_type = std::decay_t<decltype(other)>;
+    if constexpr (get_precision() == other_type::precision)
         return (value_ <=> other.value_);
-    if constexpr (get_precision() < other.get_precision())
-        return ((T(pow_10(other.get_precision() - get_precision())) * value_) <=> other.value_);
+    else if constexpr (get_precision() < other_type::precision)
+        return ((static_cast<unsigned __int128>(value_) * pow_10_v<other_type::precision - N>) <=> other.value_);
     else
-        return (value_ <=> (T(pow_10(get_precision() - other.get_precision())) * other.value_));
+        return (value_ <=> (static_cast<unsigned __int128>(other.value_) * pow_10_v<N - other_type::precision>));
 }
 
 
@@ -313,9 +312,7 @@ constexpr inline auto lime::fixed_price<N, T>::operator <=>
     price_concept auto const & other
 ) const
 {
-    if (get_precision() == other.get_precision())
-        return (value_ <=> other.get_underlying_value());
-    return (fixed_price(other) <=> *this);
+    return compare_scaled(value_, get_precision(), other.get_underlying_value(), other.get_precision());
 }
 
 
@@ -326,11 +323,7 @@ constexpr inline auto lime::fixed_price<N, T>::operator ==
     fixed_price_concept auto const & other
 ) const
 {
-    if constexpr (get_precision() == other.get_precision())
-        return (value_ == other.get_underlying_value());
-    if constexpr (get_precision() < other.get_precision())
-        return ((pow_10(other.get_precision() - get_precision()) * value_) == other.value_);
-    return (value_ == (pow_10(get_precision() - other.get_precision()) * other.value_));
+    return ((*this <=> other) == 0);
 }
 
 
@@ -341,9 +334,7 @@ constexpr inline auto lime::fixed_price<N, T>::operator ==
     price_concept auto  const & other
 ) const
 {
-    if (get_precision() == other.get_precision())
-        return (value_ == other.get_underlying_value());
-    return (fixed_price(other) == *this);
+    return (compare_scaled(value_, get_precision(), other.get_underlying_value(), other.get_precision()) == 0);
 }
 
 
@@ -0,0 +1,321 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./fixed_price.h"
+#include <include/simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define LIME_FIXED_PRICE_BATCH_X86
+#endif
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // converts source[i] to destination[i] for as many elements as both spans hold.
+    // values are scaled by 10^N and rounded to the nearest integer (ties to even).  values
+    // which are negative, nan or too large for the price saturate to zero or the maximum
+    // and the number of such values is returned.  note that rounding is of the scaled
+    // double so 1.005 (really 1.00499999999999989...) becomes 1.00 at N = 2.
+    template <std::uint32_t N, std::unsigned_integral T>
+    static std::size_t convert_to_fixed_price
+    (
+        std::span<double const>,
+        std::span<fixed_price<N, T>>
+    );
+
+
+    //=========================================================================
+    // converts source[i] to destination[i] for as many elements as both spans hold.
+    // the result is the correctly rounded quotient of the value and 10^N, identical to
+    // fixed_price::operator double().
+    template <std::uint32_t N, std::unsigned_integral T>
+    static void convert_to_double
+    (
+        std::span<fixed_price<N, T> const>,
+        std::span<double>
+    );
+
+
+    namespace fixed_price_batch
+    {
+
+        //=====================================================================
+        template <std::unsigned_integral T>
+        static inline bool to_integer
+        (
+            double value,
+            double scale,
+            T & result
+        )
+        {
+            // the maximum as a double rounds up to a power of two which is therefore exclusive
+            auto constexpr limit = double(std::numeric_limits<T>::max()) + ((sizeof(T) < sizeof(std::uint64_t)) ? 1.0 : 0.0);
+            auto rounded = std::nearbyint(value * scale);
+            if (!(rounded >= 0.0))
+            {
+                result = 0;
+                return false;
+            }
+            if (rounded >= limit)
+            {
+                result = std::numeric_limits<T>::max();
+                return false;
+            }
+            result = T(rounded);
+            return true;
+        }
+
+
+        //=====================================================================
+        template <std::unsigned_integral T>
+        static inline std::size_t to_integer_scalar
+        (
+            double const * source,
+            T * destination,
+            std::size_t count,
+            double scale
+        )
+        {
+            auto saturated = std::size_t(0);
+            for (auto i = 0ull; i < count; ++i)
+                saturated += !to_integer(source[i], scale, destination[i]);
+            return saturated;
+        }
+
+
+        //=====================================================================
+        template <std::unsigned_integral T>
+        static inline void to_double_scalar
+        (
+            T const * source,
+            double * destination,
+            std::size_t count,
+            double scale
+        )
+        {
+            for (auto i = 0ull; i < count; ++i)
+                destination[i] = (double(source[i]) / scale);
+        }
+
+
+        #if defined(LIME_FIXED_PRICE_BATCH_X86)
+
+        //=====================================================================
+        // avx2 has no double <-> uint64 conversion.  scaled values below 2^52 convert by adding
+        // 2^52 (which places the integer in the mantissa) and removing its bit pattern.  a group
+        // of four with anything else (large, negative, nan) is converted by the scalar code.
+        [[__maybe_unused__]]
+        __attribute__((target("avx2")))
+        static std::size_t to_integer_avx2
+        (
+            double const * source,
+            std::uint64_t * destination,
+            std::size_t count,
+            double scale
+        )
+        {
+            auto const scales = _mm256_set1_pd(scale);
+            auto const two_52 = _mm256_set1_pd(4503599627370496.0);
+            auto const zero = _mm256_setzero_pd();
+            auto saturated = std::size_t(0);
+            auto i = std::size_t(0);
+            for (; (i + 4) <= count; i += 4)
+            {
+                auto rounded = _mm256_round_pd(_mm256_mul_pd(_mm256_loadu_pd(source + i), scales), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                auto inRange = _mm256_and_pd(_mm256_cmp_pd(rounded, zero, _CMP_GE_OQ), _mm256_cmp_pd(rounded, two_52, _CMP_LT_OQ));
+                if (_mm256_movemask_pd(inRange) != 0xf)
+                {
+                    saturated += to_integer_scalar(source + i, destination + i, 4, scale);
+                    continue;
+                }
+                auto integer = _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(rounded, two_52)), _mm256_castpd_si256(two_52));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + i), integer);
+            }
+            return saturated + to_integer_scalar(source + i, destination + i, count - i, scale);
+        }
+
+
+        //=====================================================================
+        // exact uint64 -> double for the full range: the high and low 32 bit halves are placed
+        // in the mantissas of 2^84 and 2^52, which are then subtracted, leaving one rounding
+        // in the final add.
+        [[__maybe_unused__]]
+        __attribute__((target("avx2")))
+        static void to_double_avx2
+        (
+            std::uint64_t const * source,
+            double * destination,
+            std::size_t count,
+            double scale
+        )
+        {
+            auto const scales = _mm256_set1_pd(scale);
+            auto const two_84 = _mm256_set1_pd(19342813113834066795298816.0);
+            auto const two_52 = _mm256_set1_pd(4503599627370496.0);
+            auto const two_84_52 = _mm256_set1_pd(19342813118337666422669312.0);
+            auto i = std::size_t(0);
+            for (; (i + 4) <= count; i += 4)
+            {
+                auto integer = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(source + i));
+                auto high = _mm256_or_si256(_mm256_srli_epi64(integer, 32), _mm256_castpd_si256(two_84));
+                auto low = _mm256_blend_epi32(integer, _mm256_castpd_si256(two_52), 0xaa);
+                auto value = _mm256_add_pd(_mm256_sub_pd(_mm256_castsi256_pd(high), two_84_52), _mm256_castsi256_pd(low));
+                _mm256_storeu_pd(destination + i, _mm256_div_pd(value, scales));
+            }
+            to_double_scalar(source + i, destination + i, count - i, scale);
+        }
+
+
+        //=====================================================================
+        [[__maybe_unused__]]
+        __attribute__((target("avx512f,avx512dq,avx512vl")))
+        static std::size_t to_integer_avx512
+        (
+            double const * source,
+            std::uint64_t * destination,
+            std::size_t count,
+            double scale
+        )
+        {
+            auto const scales = _mm512_set1_pd(scale);
+            auto const limit = _mm512_set1_pd(18446744073709551616.0);
+            auto const zero = _mm512_setzero_pd();
+            auto const maximum = _mm512_set1_epi64(-1);
+            auto saturated = std::size_t(0);
+            for (auto i = std::size_t(0); i < count; i += 8)
+            {
+                auto mask = __mmask8((count - i) >= 8 ? 0xff : ((1u << (count - i)) - 1));
+                auto value = _mm512_maskz_loadu_pd(mask, source + i);
+                auto rounded = _mm512_maskz_roundscale_pd(mask, _mm512_mul_pd(value, scales), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                auto low = _mm512_mask_cmp_pd_mask(mask, rounded, zero, _CMP_NGE_UQ);
+                auto high = _mm512_mask_cmp_pd_mask(mask, rounded, limit, _CMP_GE_OQ);
+                auto integer = _mm512_maskz_cvt_roundpd_epu64(__mmask8(~(low | high)), rounded, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                integer = _mm512_mask_mov_epi64(integer, high, maximum);
+                _mm512_mask_storeu_epi64(destination + i, mask, integer);
+                saturated += std::popcount(unsigned(low | high));
+            }
+            return saturated;
+        }
+
+
+        //=====================================================================
+        [[__maybe_unused__]]
+        __attribute__((target("avx512f,avx512dq,avx512vl")))
+        static void to_double_avx512
+        (
+            std::uint64_t const * source,
+            double * destination,
+            std::size_t count,
+            double scale
+        )
+        {
+            auto const scales = _mm512_set1_pd(scale);
+            for (auto i = std::size_t(0); i < count; i += 8)
+            {
+                auto mask = __mmask8((count - i) >= 8 ? 0xff : ((1u << (count - i)) - 1));
+                auto value = _mm512_cvtepu64_pd(_mm512_maskz_loadu_epi64(mask, source + i));
+                _mm512_mask_storeu_pd(destination + i, mask, _mm512_div_pd(value, scales));
+            }
+        }
+
+        #endif
+
+    } // namespace fixed_price_batch
+
+} // namespace lime
+
+
+//=============================================================================
+template <std::uint32_t N, std::unsigned_integral T>
+std::size_t lime::convert_to_fixed_price
+(
+    std::span<double const> source,
+    std::span<fixed_price<N, T>> destination
+)
+{
+    using namespace fixed_price_batch;
+    static_assert(sizeof(fixed_price<N, T>) == sizeof(T));
+    auto count = std::min(source.size(), destination.size());
+    auto scale = double(fixed_price<N, T>::scale);
+    // fixed_price is a packed wrapper around a single T so the span is an array of T
+    auto output = reinterpret_cast<T *>(destination.data());
+    #if defined(LIME_FIXED_PRICE_BATCH_X86)
+        if constexpr (sizeof(T) == sizeof(std::uint64_t))
+        {
+            switch (get_simd_level())
+            {
+                case simd_level::avx512: return to_integer_avx512(source.data(), reinterpret_cast<std::uint64_t *>(output), count, scale);
+                case simd_level::avx2: return to_integer_avx2(source.data(), reinterpret_cast<std::uint64_t *>(output), count, scale);
+                case simd_level::scalar: break;
+            }
+        }
+    #endif
+    return to_integer_scalar(source.data(), output, count, scale);
+}
+
+
+//=============================================================================
+template <std::uint32_t N, std::unsigned_integral T>
+void lime::convert_to_double
+(
+    std::span<fixed_price<N, T> const> source,
+    std::span<double> destination
+)
+{
+    using namespace fixed_price_batch;
+    static_assert(sizeof(fixed_price<N, T>) == sizeof(T));
+    auto count = std::min(source.size(), destination.size());
+    auto scale = double(fixed_price<N, T>::scale);
+    auto input = reinterpret_cast<T const *>(source.data());
+    #if defined(LIME_FIXED_PRICE_BATCH_X86)
+        if constexpr (sizeof(T) == sizeof(std::uint64_t))
+        {
+            switch (get_simd_level())
+            {
+                case simd_level::avx512: to_double_avx512(reinterpret_cast<std::uint64_t const *>(input), destination.data(), count, scale); return;
+                case simd_level::avx2: to_double_avx2(reinterpret_cast<std::uint64_t const *>(input), destination.data(), count, scale); return;
+                case simd_level::scalar: break;
+            }
+        }
+    #endif
+    to_double_scalar(input, destination.data(), count, scale);
+}
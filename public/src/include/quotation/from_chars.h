@@ -0,0 +1,252 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./price.h"
+#include "./fixed_price.h"
+
+#include <bit>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <system_error>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // an unsigned ascii decimal as written: all of its digits and the number of them
+    // which followed the decimal point
+    struct parsed_decimal
+    {
+        std::uint64_t   value_;
+        std::uint32_t   precision_;
+    };
+
+
+    //=========================================================================
+    // converts eight ascii digits (first character most significant) in one word.  pairs,
+    // then quads, then the octet are combined with three multiplies rather than eight.
+    // returns nullopt if any byte is not a digit.
+    [[__maybe_unused__]]
+    static inline std::optional<std::uint32_t> parse_eight_digits
+    (
+        std::uint64_t word
+    )
+    {
+        static_assert(std::endian::native == std::endian::little, "digit words assume little endian");
+        // each byte is a digit if its high nibble is 3 and adding 6 does not carry out of its low nibble
+        if ((((word & 0xf0f0f0f0f0f0f0f0ull) | (((word + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) != 0x3333333333333333ull))
+            return std::nullopt;
+        word -= 0x3030303030303030ull;
+        word = ((word * 10) + (word >> 8)) & 0x00ff00ff00ff00ffull;
+        word = ((word * 100) + (word >> 16)) & 0x0000ffff0000ffffull;
+        return std::uint32_t((word * 10000) + (word >> 32));
+    }
+
+
+    //=========================================================================
+    // the last min(8, last - first) characters of [first, last) as a word, left padded with
+    // '0' characters.  nothing outside of [first, last) is read.
+    [[__maybe_unused__]]
+    static inline std::uint64_t load_digit_word
+    (
+        char const * first,
+        char const * last
+    )
+    {
+        static auto constexpr zeros = 0x3030303030303030ull;
+        auto count = std::size_t(last - first);
+        std::uint64_t word;
+        if (count >= 8)
+        {
+            std::memcpy(&word, last - 8, 8);
+            return word;
+        }
+        if (count == 0)
+            return zeros;
+        // shorter runs are assembled from two (possibly overlapping) loads within the run
+        auto shift = ((8 - count) * 8);
+        word = (zeros & ((std::uint64_t(1) << shift) - 1));
+        if (count >= 4)
+        {
+            std::uint32_t head;
+            std::uint32_t tail;
+            std::memcpy(&head, first, 4);
+            std::memcpy(&tail, last - 4, 4);
+            word |= (std::uint64_t(head) << shift);
+            return ((word & 0x00000000ffffffffull) | (std::uint64_t(tail) << 32));
+        }
+        if (count >= 2)
+        {
+            std::uint16_t head;
+            std::uint16_t tail;
+            std::memcpy(&head, first, 2);
+            std::memcpy(&tail, last - 2, 2);
+            word |= (std::uint64_t(head) << shift);
+            return ((word & 0x0000ffffffffffffull) | (std::uint64_t(tail) << 48));
+        }
+        return (word | (std::uint64_t(static_cast<unsigned char>(*first)) << 56));
+    }
+
+
+    //=========================================================================
+    // value of up to 19 ascii digits converted eight at a time.  a leading partial
+    // group is converted first so the remaining groups are full words.
+    [[__maybe_unused__]]
+    static inline std::optional<std::uint64_t> parse_digits
+    (
+        char const * first,
+        char const * last
+    )
+    {
+        if ((last - first) > std::numeric_limits<std::uint64_t>::digits10)
+            return std::nullopt;
+        auto partial = ((last - first) % 8);
+        auto head = parse_eight_digits(load_digit_word(first, first + partial));
+        if (!head)
+            return std::nullopt;
+        std::uint64_t value = *head;
+        for (first += partial; first < last; first += 8)
+        {
+            auto eight = parse_eight_digits(load_digit_word(first, first + 8));
+            if (!eight)
+                return std::nullopt;
+            value = (value * 100000000) + *eight;
+        }
+        return value;
+    }
+
+
+    //=========================================================================
+    // [digits][.digits] with at least one digit.  no sign, exponent or white space.
+    // at most 19 significant digits are accepted so the value always fits in 64 bits.
+    // fractional digits beyond maximumPrecision are accepted only if they are zeros, in
+    // which case they are dropped ("1.2300" with a maximum of 2 is 123 at precision 2).
+    [[__maybe_unused__]]
+    static inline std::optional<parsed_decimal> parse_decimal
+    (
+        std::string_view source,
+        std::uint32_t maximumPrecision = std::numeric_limits<std::uint32_t>::max()
+    )
+    {
+        if (source.empty())
+            return std::nullopt;
+        auto first = source.data();
+        auto last = (first + source.size());
+        auto point = static_cast<char const *>(std::memchr(first, '.', source.size()));
+        auto integerLast = (point == nullptr) ? last : point;
+        auto fractionFirst = (point == nullptr) ? last : (point + 1);
+        if ((first == integerLast) && (fractionFirst == last))
+            return std::nullopt;
+        while ((std::uint32_t(last - fractionFirst) > maximumPrecision) && (last[-1] == '0'))
+            --last;
+        if (std::uint32_t(last - fractionFirst) > maximumPrecision)
+            return std::nullopt;
+        if (((integerLast - first) + (last - fractionFirst)) > std::numeric_limits<std::uint64_t>::digits10)
+            while ((first < (integerLast - 1)) && (*first == '0'))
+                ++first;
+
+        auto integerValue = parse_digits(first, integerLast);
+        auto fractionValue = parse_digits(fractionFirst, last);
+        if ((!integerValue) || (!fractionValue) ||
+                (((integerLast - first) + (last - fractionFirst)) > std::numeric_limits<std::uint64_t>::digits10))
+            return std::nullopt;
+        return parsed_decimal{(*integerValue * pow_10(last - fractionFirst)) + *fractionValue, std::uint32_t(last - fractionFirst)};
+    }
+
+
+    //=========================================================================
+    // the price with the precision as written ("1.50" has precision 2)
+    [[__maybe_unused__]]
+    static inline std::from_chars_result from_chars
+    (
+        char const * first,
+        char const * last,
+        price_concept auto & price
+    )
+    {
+        using value_type = decltype(price.get_underlying_value());
+        auto decimal = parse_decimal({first, std::size_t(last - first)});
+        if ((!decimal) || (decimal->precision_ > std::numeric_limits<std::uint8_t>::max()))
+            return {first, std::errc::invalid_argument};
+        if (decimal->value_ > std::numeric_limits<value_type>::max())
+            return {first, std::errc::result_out_of_range};
+        price = std::decay_t<decltype(price)>(value_type(decimal->value_), std::uint8_t(decimal->precision_));
+        return {last, std::errc()};
+    }
+
+
+    //=========================================================================
+    // the price at precision N.  digits beyond N are accepted only if they are zeros
+    // (there is no rounding) so "1.2300" parses as fixed_price<2> but "1.2345" does not.
+    [[__maybe_unused__]]
+    static inline std::from_chars_result from_chars
+    (
+        char const * first,
+        char const * last,
+        fixed_price_concept auto & price
+    )
+    {
+        using price_type = std::decay_t<decltype(price)>;
+        using value_type = typename price_type::value_type;
+        auto decimal = parse_decimal({first, std::size_t(last - first)}, price_type::precision);
+        if (!decimal)
+            return {first, std::errc::invalid_argument};
+        auto scale = pow_10(price_type::precision - decimal->precision_);
+        if ((scale == 0) || ((static_cast<unsigned __int128>(decimal->value_) * scale) > std::numeric_limits<value_type>::max()))
+            return {first, std::errc::result_out_of_range};
+        price = price_type(lime::price<value_type>(value_type(decimal->value_ * scale), std::uint8_t(price_type::precision)));
+        return {last, std::errc()};
+    }
+
+
+    //=========================================================================
+    template <typename T>
+    requires (price_concept<T> || fixed_price_concept<T>)
+    [[__maybe_unused__]]
+    static inline std::optional<T> from_string
+    (
+        std::string_view source
+    )
+    {
+        T result;
+        auto [end, error] = from_chars(source.data(), source.data() + source.size(), result);
+        if ((error != std::errc()) || (end != (source.data() + source.size())))
+            return std::nullopt;
+        return result;
+    }
+
+} // namespace lime
@@ -0,0 +1,455 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./to_chars.h"
+#include "./price.h"
+#include "./fixed_price.h"
+#include "./shares.h"
+
+#include <array>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // what happens when a notional does not fit in 64 bits:
+    //  saturate - the value is clamped to the minimum or maximum
+    //  trap     - the process traps (risk checks which must never act on a wrong value)
+    //  report   - the value is clamped and the notional is flagged (sticky through arithmetic)
+    enum class overflow_policy : std::uint8_t
+    {
+        saturate    = 0,
+        trap        = 1,
+        report      = 2
+    };
+
+
+    //=========================================================================
+    // 128 bit arithmetic which saturates rather than wraps.  intermediates of notional
+    // calculations use these so that only the final narrowing can overflow in practice.
+    using wide_integer = __int128;
+
+    inline constexpr wide_integer wide_integer_maximum = wide_integer((static_cast<unsigned __int128>(1) << 127) - 1);
+    inline constexpr wide_integer wide_integer_minimum = (-wide_integer_maximum - 1);
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr bool multiply_saturated
+    (
+        wide_integer first,
+        wide_integer second,
+        wide_integer & result
+    )
+    {
+        if (__builtin_mul_overflow(first, second, &result))
+        {
+            result = (((first < 0) != (second < 0)) ? wide_integer_minimum : wide_integer_maximum);
+            return false;
+        }
+        return true;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr bool add_saturated
+    (
+        wide_integer first,
+        wide_integer second,
+        wide_integer & result
+    )
+    {
+        if (__builtin_add_overflow(first, second, &result))
+        {
+            result = ((first < 0) ? wide_integer_minimum : wide_integer_maximum);
+            return false;
+        }
+        return true;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr bool subtract_saturated
+    (
+        wide_integer first,
+        wide_integer second,
+        wide_integer & result
+    )
+    {
+        if (__builtin_sub_overflow(first, second, &result))
+        {
+            result = ((first < 0) ? wide_integer_minimum : wide_integer_maximum);
+            return false;
+        }
+        return true;
+    }
+
+
+    //=========================================================================
+    // value * 10^(to - from) rounding half away from zero when precision is reduced
+    [[__maybe_unused__]]
+    static constexpr bool rescale_saturated
+    (
+        wide_integer value,
+        std::uint32_t from,
+        std::uint32_t to,
+        wide_integer & result
+    )
+    {
+        if (from == to)
+        {
+            result = value;
+            return true;
+        }
+        if (from < to)
+        {
+            auto scale = wide_integer(1);
+            for (auto i = from; i < to; ++i)
+                if (!multiply_saturated(scale, 10, scale))
+                    break;
+            return multiply_saturated(value, scale, result);
+        }
+        // 10^38 is the largest power of ten in 128 bits and any value divided by 10^39 is
+        // less than a half in magnitude so larger reductions round to zero
+        if ((from - to) > 38)
+        {
+            result = 0;
+            return true;
+        }
+        auto scale = wide_integer(1);
+        for (auto i = to; i < from; ++i)
+            scale *= 10;
+        auto quotient = (value / scale);
+        auto remainder = (value % scale);
+        auto magnitude = (remainder < 0) ? -remainder : remainder;
+        if (magnitude >= (scale - magnitude))
+            quotient += ((value < 0) ? -1 : 1);
+        result = quotient;
+        return true;
+    }
+
+
+    template <std::uint32_t N, overflow_policy P> class notional;
+
+    template <typename T>
+    concept notional_concept = std::is_same_v<T, notional<T::precision, T::policy>>;
+
+
+    //=========================================================================
+    // a signed amount of currency (price * shares * multiplier) with N decimal places in
+    // 64 bits.  products are formed in 128 bits so they are exact until the final narrowing
+    // which is then handled according to the overflow policy.
+    template <std::uint32_t N = 4, overflow_policy P = overflow_policy::saturate>
+    class notional
+    {
+    public:
+
+        using value_type = std::int64_t;
+        static auto constexpr precision = N;
+        static auto constexpr policy = P;
+
+        constexpr notional() = default;
+
+        explicit constexpr notional
+        (
+            value_type
+        );
+
+        // price * shares * multiplier
+        constexpr notional
+        (
+            price_concept auto,
+            shares_concept auto,
+            std::int64_t = 1
+        );
+
+        constexpr notional
+        (
+            fixed_price_concept auto,
+            shares_concept auto,
+            std::int64_t = 1
+        );
+
+        // a value of the given precision, narrowed according to the policy
+        static constexpr notional from_wide_integer
+        (
+            wide_integer,
+            std::uint32_t = N,
+            bool = false
+        );
+
+        template <std::floating_point T_>
+        constexpr operator T_() const;
+
+        constexpr value_type get_underlying_value() const{return value_;}
+
+        static constexpr auto get_precision(){return precision;}
+
+        constexpr bool has_overflowed() const;
+
+        constexpr notional operator - () const;
+
+        constexpr notional operator + (notional const &) const;
+
+        constexpr notional operator - (notional const &) const;
+
+        constexpr notional & operator += (notional const &);
+
+        constexpr notional & operator -= (notional const &);
+
+        constexpr auto operator <=> (notional const & other) const{return (value_ <=> other.value_);}
+
+        constexpr bool operator == (notional const & other) const{return (value_ == other.value_);}
+
+    private:
+
+        struct no_overflow_flag
+        {
+            constexpr operator bool() const{return false;}
+            constexpr no_overflow_flag & operator = (bool){return *this;}
+        };
+
+        using overflow_flag = std::conditional_t<P == overflow_policy::report, bool, no_overflow_flag>;
+
+        value_type                          value_{0};
+
+        [[no_unique_address]] overflow_flag overflowed_{};
+    };
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars
+    (
+        char * first,
+        char * last,
+        notional_concept auto notional
+    )
+    {
+        auto value = notional.get_underlying_value();
+        if (value >= 0)
+            return to_chars_fixed_point(first, last, std::uint64_t(value), notional.get_precision());
+        if (first == last)
+            return {last, std::errc::value_too_large};
+        *first = '-';
+        return to_chars_fixed_point(first + 1, last, std::uint64_t(0) - std::uint64_t(value), notional.get_precision());
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static std::string to_string
+    (
+        notional_concept auto notional
+    )
+    {
+        std::array<char, 3 + std::numeric_limits<std::int64_t>::digits10 + notional.get_precision()> buffer;
+        auto [end, _] = to_chars(buffer.data(), buffer.data() + buffer.size(), notional);
+        return std::string(buffer.data(), end);
+    }
+
+} // namespace lime
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr lime::notional<N, P>::notional
+(
+    value_type value
+):
+    value_(value)
+{
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr lime::notional<N, P>::notional
+(
+    price_concept auto price,
+    shares_concept auto shares,
+    std::int64_t multiplier
+)
+{
+    wide_integer value;
+    auto exact = multiply_saturated(wide_integer(price.get_underlying_value()), wide_integer(shares.get()), value);
+    exact &= multiply_saturated(value, multiplier, value);
+    *this = from_wide_integer(value, price.get_precision(), !exact);
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr lime::notional<N, P>::notional
+(
+    fixed_price_concept auto price,
+    shares_concept auto shares,
+    std::int64_t multiplier
+)
+{
+    wide_integer value;
+    auto exact = multiply_saturated(wide_integer(price.get_underlying_value()), wide_integer(shares.get()), value);
+    exact &= multiply_saturated(value, multiplier, value);
+    *this = from_wide_integer(value, price.get_precision(), !exact);
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr auto lime::notional<N, P>::from_wide_integer
+(
+    wide_integer value,
+    std::uint32_t precision,
+    bool overflowed
+) -> notional
+{
+    auto exact = rescale_saturated(value, precision, N, value);
+    overflowed |= !exact;
+    notional result;
+    if (value > std::numeric_limits<value_type>::max())
+    {
+        result.value_ = std::numeric_limits<value_type>::max();
+        overflowed = true;
+    }
+    else if (value < std::numeric_limits<value_type>::min())
+    {
+        result.value_ = std::numeric_limits<value_type>::min();
+        overflowed = true;
+    }
+    else
+    {
+        result.value_ = value_type(value);
+    }
+    if constexpr (P == overflow_policy::trap)
+    {
+        if (overflowed)
+            __builtin_trap();
+    }
+    result.overflowed_ = overflowed;
+    return result;
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+template <std::floating_point T_>
+constexpr lime::notional<N, P>::operator T_
+(
+) const
+{
+    return ((T_)value_ / pow_10_v<N>);
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr bool lime::notional<N, P>::has_overflowed
+(
+) const
+{
+    return overflowed_;
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr auto lime::notional<N, P>::operator -
+(
+) const -> notional
+{
+    return from_wide_integer(-wide_integer(value_), N, overflowed_);
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr auto lime::notional<N, P>::operator +
+(
+    notional const & other
+) const -> notional
+{
+    return from_wide_integer(wide_integer(value_) + other.value_, N, (overflowed_ || other.overflowed_));
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr auto lime::notional<N, P>::operator -
+(
+    notional const & other
+) const -> notional
+{
+    return from_wide_integer(wide_integer(value_) - other.value_, N, (overflowed_ || other.overflowed_));
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr auto lime::notional<N, P>::operator +=
+(
+    notional const & other
+) -> notional &
+{
+    return (*this = (*this + other));
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P>
+constexpr auto lime::notional<N, P>::operator -=
+(
+    notional const & other
+) -> notional &
+{
+    return (*this = (*this - other));
+}
+
+
+//=========================================================================
+[[__maybe_unused__]]
+static std::ostream & operator << 
+(
+    std::ostream & stream,
+    lime::notional_concept auto const & notional 
+)
+{
+    stream << to_string(notional);
+    return stream;
+}
@@ -0,0 +1,313 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./notional.h"
+#include "./fixed_price.h"
+#include <include/simd.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define LIME_NOTIONAL_BATCH_X86
+#endif
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // sum of prices[i] * shares[i] * multiplier (for as many elements as both spans hold),
+    // exact until the final narrowing to the notional's precision and 64 bits which follows
+    // the notional's overflow policy.  positions are signed (short is negative).
+    template <std::uint32_t N = 4, overflow_policy P = overflow_policy::saturate, std::uint32_t N_, std::unsigned_integral T>
+    static notional<N, P> aggregate_notional
+    (
+        std::span<fixed_price<N_, T> const>,
+        std::span<std::int64_t const>,
+        std::int64_t = 1
+    );
+
+
+    //=========================================================================
+    // sum of (marks[i] - costs[i]) * shares[i] * multiplier.  as aggregation is linear
+    // this is the difference of the two aggregates, each computed exactly.
+    template <std::uint32_t N = 4, overflow_policy P = overflow_policy::saturate, std::uint32_t N_, std::unsigned_integral T>
+    static notional<N, P> aggregate_profit_and_loss
+    (
+        std::span<fixed_price<N_, T> const>,
+        std::span<fixed_price<N_, T> const>,
+        std::span<std::int64_t const>,
+        std::int64_t = 1
+    );
+
+
+    namespace notional_batch
+    {
+
+        //=====================================================================
+        // a 128 bit sum which counts the times it wraps.  it is exact (and so independent of
+        // the order in which terms are added, which differs between the simd levels) for
+        // fewer than 2^63 terms and is clamped to 128 bits only once the sum is complete.
+        struct wide_sum
+        {
+            wide_integer    low_{0};
+            std::int64_t    wraps_{0};
+
+            void add(wide_integer value)
+            {
+                if (__builtin_add_overflow(low_, value, &low_))
+                    wraps_ += ((value < 0) ? -1 : 1);
+            }
+
+            void add(wide_sum const & other)
+            {
+                add(other.low_);
+                wraps_ += other.wraps_;
+            }
+
+            void subtract(wide_sum const & other)
+            {
+                if (__builtin_sub_overflow(low_, other.low_, &low_))
+                    wraps_ += ((other.low_ < 0) ? 1 : -1);
+                wraps_ -= other.wraps_;
+            }
+
+            // the sum clamped to 128 bits.  returns false if it was clamped.
+            bool get(wide_integer & result) const
+            {
+                result = ((wraps_ == 0) ? low_ : ((wraps_ > 0) ? wide_integer_maximum : wide_integer_minimum));
+                return (wraps_ == 0);
+            }
+        };
+
+
+        //=====================================================================
+        // exact sum of products.  returns false if a product overflowed 128 bits (which an
+        // unsigned 64 bit price and a signed 64 bit position can not).
+        template <std::unsigned_integral T>
+        static inline bool aggregate_scalar
+        (
+            T const * prices,
+            std::int64_t const * shares,
+            std::size_t count,
+            wide_sum & sum
+        )
+        {
+            auto exact = true;
+            for (auto i = 0ull; i < count; ++i)
+            {
+                wide_integer product;
+                exact &= multiply_saturated(wide_integer(prices[i]), wide_integer(shares[i]), product);
+                sum.add(product);
+            }
+            return exact;
+        }
+
+
+        #if defined(LIME_NOTIONAL_BATCH_X86)
+
+        //=====================================================================
+        // prices below 2^31 and shares in [-2^31, 2^31) multiply exactly with the 32 x 32 -> 64
+        // bit signed multiply and are summed in 64 bit lanes with the overflow of each add
+        // detected from the signs.  groups with larger operands are summed by the scalar code
+        // and if any lane overflows the whole span is summed by the scalar code.
+        [[__maybe_unused__]]
+        __attribute__((target("avx2")))
+        static bool aggregate_avx2
+        (
+            std::uint64_t const * prices,
+            std::int64_t const * shares,
+            std::size_t count,
+            wide_sum & sum
+        )
+        {
+            auto const zero = _mm256_setzero_si256();
+            auto const bias = _mm256_set1_epi64x(std::int64_t(1) << 31);
+            auto accumulator = zero;
+            auto overflow = zero;
+            auto exact = true;
+            auto partial = wide_sum();
+            auto i = std::size_t(0);
+            for (; (i + 4) <= count; i += 4)
+            {
+                auto price = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(prices + i));
+                auto quantity = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(shares + i));
+                auto outOfRange = _mm256_or_si256(_mm256_srli_epi64(price, 31), _mm256_srli_epi64(_mm256_add_epi64(quantity, bias), 32));
+                if (!_mm256_testz_si256(outOfRange, outOfRange))
+                {
+                    exact &= aggregate_scalar(prices + i, shares + i, 4, partial);
+                    continue;
+                }
+                auto product = _mm256_mul_epi32(price, quantity);
+                auto total = _mm256_add_epi64(accumulator, product);
+                overflow = _mm256_or_si256(overflow, _mm256_and_si256(_mm256_xor_si256(accumulator, total), _mm256_xor_si256(product, total)));
+                accumulator = total;
+            }
+            if (_mm256_movemask_pd(_mm256_castsi256_pd(overflow)) != 0)
+                return aggregate_scalar(prices, shares, count, sum);
+
+            alignas(32) std::int64_t lanes[4];
+            _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), accumulator);
+            for (auto lane : lanes)
+                partial.add(lane);
+            exact &= aggregate_scalar(prices + i, shares + i, count - i, partial);
+            sum.add(partial);
+            return exact;
+        }
+
+
+        //=====================================================================
+        [[__maybe_unused__]]
+        __attribute__((target("avx512f,avx512dq,avx512vl")))
+        static bool aggregate_avx512
+        (
+            std::uint64_t const * prices,
+            std::int64_t const * shares,
+            std::size_t count,
+            wide_sum & sum
+        )
+        {
+            auto const zero = _mm512_setzero_si512();
+            auto const bias = _mm512_set1_epi64(std::int64_t(1) << 31);
+            auto const price_limit = _mm512_set1_epi64(std::int64_t(1) << 31);
+            auto const shares_limit = _mm512_set1_epi64(std::int64_t(1) << 32);
+            auto accumulator = zero;
+            auto overflow = __mmask8(0);
+            auto exact = true;
+            auto partial = wide_sum();
+            for (auto i = std::size_t(0); i < count; i += 8)
+            {
+                auto mask = __mmask8((count - i) >= 8 ? 0xff : ((1u << (count - i)) - 1));
+                auto price = _mm512_maskz_loadu_epi64(mask, prices + i);
+                auto quantity = _mm512_maskz_loadu_epi64(mask, shares + i);
+                auto inRange = _mm512_mask_cmplt_epu64_mask(_mm512_cmplt_epu64_mask(price, price_limit), _mm512_add_epi64(quantity, bias), shares_limit);
+                for (auto lanes = unsigned(mask & ~inRange); lanes != 0; lanes &= (lanes - 1))
+                {
+                    auto lane = i + std::countr_zero(lanes);
+                    exact &= aggregate_scalar(prices + lane, shares + lane, 1, partial);
+                }
+                auto product = _mm512_maskz_mul_epi32(__mmask8(mask & inRange), price, quantity);
+                auto total = _mm512_add_epi64(accumulator, product);
+                overflow |= _mm512_cmplt_epi64_mask(_mm512_and_si512(_mm512_xor_si512(accumulator, total), _mm512_xor_si512(product, total)), zero);
+                accumulator = total;
+            }
+            if (overflow != 0)
+                return aggregate_scalar(prices, shares, count, sum);
+
+            alignas(64) std::int64_t lanes[8];
+            _mm512_store_si512(lanes, accumulator);
+            for (auto lane : lanes)
+                partial.add(lane);
+            sum.add(partial);
+            return exact;
+        }
+
+        #endif
+
+
+        //=====================================================================
+        template <std::unsigned_integral T>
+        static bool aggregate
+        (
+            T const * prices,
+            std::int64_t const * shares,
+            std::size_t count,
+            wide_sum & sum
+        )
+        {
+            #if defined(LIME_NOTIONAL_BATCH_X86)
+                if constexpr (sizeof(T) == sizeof(std::uint64_t))
+                {
+                    switch (get_simd_level())
+                    {
+                        case simd_level::avx512: return aggregate_avx512(reinterpret_cast<std::uint64_t const *>(prices), shares, count, sum);
+                        case simd_level::avx2: return aggregate_avx2(reinterpret_cast<std::uint64_t const *>(prices), shares, count, sum);
+                        case simd_level::scalar: break;
+                    }
+                }
+            #endif
+            return aggregate_scalar(prices, shares, count, sum);
+        }
+
+    } // namespace notional_batch
+
+} // namespace lime
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P, std::uint32_t N_, std::unsigned_integral T>
+lime::notional<N, P> lime::aggregate_notional
+(
+    std::span<fixed_price<N_, T> const> prices,
+    std::span<std::int64_t const> shares,
+    std::int64_t multiplier
+)
+{
+    static_assert(sizeof(fixed_price<N_, T>) == sizeof(T));
+    auto count = std::min(prices.size(), shares.size());
+    // fixed_price is a packed wrapper around a single T so the span is an array of T
+    auto total = notional_batch::wide_sum();
+    auto exact = notional_batch::aggregate(reinterpret_cast<T const *>(prices.data()), shares.data(), count, total);
+    wide_integer sum;
+    exact &= total.get(sum);
+    exact &= multiply_saturated(sum, multiplier, sum);
+    return notional<N, P>::from_wide_integer(sum, N_, !exact);
+}
+
+
+//=============================================================================
+template <std::uint32_t N, lime::overflow_policy P, std::uint32_t N_, std::unsigned_integral T>
+lime::notional<N, P> lime::aggregate_profit_and_loss
+(
+    std::span<fixed_price<N_, T> const> marks,
+    std::span<fixed_price<N_, T> const> costs,
+    std::span<std::int64_t const> shares,
+    std::int64_t multiplier
+)
+{
+    static_assert(sizeof(fixed_price<N_, T>) == sizeof(T));
+    auto count = std::min({marks.size(), costs.size(), shares.size()});
+    auto markSum = notional_batch::wide_sum();
+    auto costSum = notional_batch::wide_sum();
+    auto exact = notional_batch::aggregate(reinterpret_cast<T const *>(marks.data()), shares.data(), count, markSum);
+    exact &= notional_batch::aggregate(reinterpret_cast<T const *>(costs.data()), shares.data(), count, costSum);
+    // the difference is taken before clamping so that two sums beyond 128 bits still cancel
+    markSum.subtract(costSum);
+    wide_integer sum;
+    exact &= markSum.get(sum);
+    exact &= multiply_saturated(sum, multiplier, sum);
+    return notional<N, P>::from_wide_integer(sum, N_, !exact);
+}
@@ -29,9 +29,13 @@ SOFTWARE.
 
 #pragma once
 
+#include "./to_chars.h"
 #include <include/endian.h>
 #include <include/concepts/numeric_concept.h>
 
+#include <algorithm>
+#include <array>
+#include <compare>
 #include <concepts>
 #include <type_traits>
 #include <cstdint>
@@ -78,6 +82,95 @@ namespace lime
        return 0;
     }
 
+    //=========================================================================
+    template <std::uint64_t N>
+    inline constexpr std::uint64_t pow_10_v = pow_10(N);
+
+
+    //=========================================================================
+    // division by 10^n without a div instruction.  for d = 10^n, s = floor(log2(d)) and
+    // m = floor(2^(64 + s) / d) (which fits in 64 bits) the high half of value * m shifted
+    // by s is the quotient or one less than it, which a single compare corrects.
+    struct pow_10_reciprocal
+    {
+        std::uint64_t   divisor_;
+        std::uint64_t   multiplier_;
+        std::uint8_t    shift_;
+    };
+
+    inline constexpr auto pow_10_reciprocal_table = []()
+            {
+                std::array<pow_10_reciprocal, 20> table{};
+                unsigned __int128 divisor = 1;
+                for (auto & entry : table)
+                {
+                    auto shift = std::uint8_t(0);
+                    while ((divisor >> (shift + 1)) != 0)
+                        ++shift;
+                    entry = {std::uint64_t(divisor), std::uint64_t((static_cast<unsigned __int128>(1) << (64 + shift)) / divisor), shift};
+                    divisor *= 10;
+                }
+                return table;
+            }();
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr auto divide_by_pow_10
+    (
+        std::unsigned_integral auto value,
+        std::uint64_t n
+    ) -> decltype(value)
+    {
+        using type = decltype(value);
+        if constexpr (sizeof(type) > sizeof(std::uint64_t))
+        {
+            while ((n-- > 0) && (value != 0))
+                value /= 10;
+            return value;
+        }
+        else
+        {
+            if (n == 0)
+                return value;
+            if (n >= pow_10_reciprocal_table.size())
+                return 0;
+            auto const & reciprocal = pow_10_reciprocal_table[n];
+            auto quotient = (std::uint64_t((static_cast<unsigned __int128>(value) * reciprocal.multiplier_) >> 64) >> reciprocal.shift_);
+            if ((value - (quotient * reciprocal.divisor_)) >= reciprocal.divisor_)
+                ++quotient;
+            return type(quotient);
+        }
+    }
+
+
+    //=========================================================================
+    // compares first * 10^-firstPrecision with second * 10^-secondPrecision exactly by
+    // scaling the lower precision value up in 128 bits (no division, no overflow).
+    [[__maybe_unused__]]
+    static constexpr std::strong_ordering compare_scaled
+    (
+        std::unsigned_integral auto first,
+        std::uint64_t firstPrecision,
+        std::unsigned_integral auto second,
+        std::uint64_t secondPrecision
+    )
+    {
+        static_assert((sizeof(first) <= sizeof(std::uint64_t)) && (sizeof(second) <= sizeof(std::uint64_t)));
+        using wide_type = unsigned __int128;
+        auto constexpr maximum_difference = std::int64_t(pow_10_reciprocal_table.size() - 1);
+
+        auto difference = (std::int64_t(secondPrecision) - std::int64_t(firstPrecision));
+        if (difference > maximum_difference)
+            return (first == 0) ? (0 <=> std::uint64_t(second)) : std::strong_ordering::greater;
+        if (difference < -maximum_difference)
+            return (second == 0) ? (std::uint64_t(first) <=> 0) : std::strong_ordering::less;
+        auto firstScale = pow_10_reciprocal_table[std::max<std::int64_t>(difference, 0)].divisor_;
+        auto secondScale = pow_10_reciprocal_table[std::max<std::int64_t>(-difference, 0)].divisor_;
+        return ((wide_type(first) * firstScale) <=> (wide_type(second) * secondScale));
+    }
+
+
     template <std::unsigned_integral T> class price;
 
     template <typename T>
@@ -128,12 +221,12 @@ namespace lime
         constexpr auto get_underlying_value() const;
         constexpr auto get_precision() const;
 
-        constexpr auto operator <=> 
+        constexpr std::strong_ordering operator <=> 
         (
             price_concept auto const &
         ) const;
 
-        constexpr auto operator == 
+        constexpr bool operator == 
         (
             price_concept auto const &
         ) const;
@@ -160,6 +253,19 @@ namespace lime
     }    
 
 
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars
+    (
+        char * first,
+        char * last,
+        price_concept auto price
+    )
+    {
+        return to_chars_fixed_point(first, last, price.get_underlying_value(), price.get_precision());
+    }
+
+
     //=========================================================================
     [[__maybe_unused__]]
     static std::string to_string
@@ -167,18 +273,9 @@ namespace lime
         price_concept auto price
     )
     {
-        if (price.get_precision() == 0)
-            return std::to_string(price.get_underlying_value());
-
-        auto s = std::to_string(price.get_underlying_value());
-        while (s.size() <= price.get_precision())
-            s = '0' + s;
-        s.resize(s.size() + 1);
-        auto beg = s.size() - 1;
-        auto end = (beg - price.get_precision());
-        for (auto i = beg; i >= end; --i)
-            s[i] = (i == end) ? '.' : s[i - 1];
-        return s;
+        std::array<char, 2 + std::numeric_limits<decltype(price.get_underlying_value())>::digits10 + std::numeric_limits<std::uint8_t>::max()> buffer;
+        auto [end, _] = to_chars(buffer.data(), buffer.data() + buffer.size(), price);
+        return std::string(buffer.data(), end);
     }
 
 } // namespace lime
@@ -297,7 +394,7 @@ void lime::price<T>::set_precision
     if (precision != precision_)
     {
         if (precision < precision_)
-            value_ /= T(pow_10(precision_ - precision));
+            value_ = divide_by_pow_10(value_, precision_ - precision);
         else
             value_ *= T(pow_10(precision - precision_));
         precision_ = precision;
@@ -330,13 +427,9 @@ template <std::unsigned_integral T>
 constexpr inline auto lime::price<T>::operator <=> 
 (
     price_concept auto  const & other
-) const
+) const -> std::strong_ordering
 {
-    if (precision_ == other.precision_)
-        return (value_ <=> other.value_);
-    if (precision_ < other.precision_)
-        return ((T(pow_10(other.precision_ - precision_)) * value_) <=> other.value_);
-    return (value_ <=> (T(pow_10(precision_ - other.precision_)) * other.value_));
+    return compare_scaled(value_, precision_, other.value_, other.precision_);
 }
 
 
@@ -345,13 +438,11 @@ template <std::unsigned_integral T>
 constexpr inline auto lime::price<T>::operator == 
 (
     price_concept auto  const & other
-) const
+) const -> bool
 {
     if (precision_ == other.precision_)
         return (value_ == other.value_);
-    if (precision_ < other.precision_)
-        return ((pow_10(other.precision_ - precision_) * value_) == other.value_);
-    return (value_ == (pow_10(precision_ - other.precision_) * other.value_));
+    return (compare_scaled(value_, precision_, other.value_, other.precision_) == 0);
 }
 
 
@@ -32,6 +32,8 @@ SOFTWARE.
 #include "./shares.h"
 #include "./price.h"
 #include "./fixed_price.h"
+#include "./from_chars.h"
+#include "./notional.h"
 
 #include <type_traits>
 #include <concepts>
@@ -189,6 +191,19 @@ namespace lime
     }    
 
 
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars
+    (
+        char * first,
+        char * last,
+        quotation_concept auto source
+    )
+    {
+        return to_chars(first, last, source.get());
+    }
+
+
     //=========================================================================
     [[__maybe_unused__]]
     static constexpr inline std::string to_string
@@ -29,9 +29,12 @@ SOFTWARE.
 
 #pragma once
 
+#include "./to_chars.h"
 #include <include/endian.h>
 #include <include/concepts/numeric_concept.h>
 
+#include <array>
+#include <limits>
 #include <string>
 #include <cstdint>
 #include <type_traits>
@@ -109,6 +112,19 @@ namespace lime
     }
 
 
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars
+    (
+        char * first,
+        char * last,
+        shares_concept auto source
+    )
+    {
+        return to_chars_decimal(first, last, source.get());
+    }
+
+
     //=========================================================================
     [[__maybe_unused__]]
     static std::string to_string
@@ -116,7 +132,9 @@ namespace lime
         shares_concept auto source
     )
     {
-        return std::to_string(source.get());
+        std::array<char, 2 + std::numeric_limits<decltype(source.get())>::digits10> buffer;
+        auto [end, _] = to_chars(buffer.data(), buffer.data() + buffer.size(), source);
+        return std::string(buffer.data(), end);
     }
 
 } // namespace lime
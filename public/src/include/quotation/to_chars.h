@@ -0,0 +1,161 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <concepts>
+#include <cstdint>
+#include <system_error>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // "00" through "99".  integers are written two digits per step from the least
+    // significant end which halves the number of divisions (by a constant, so multiplies).
+    inline constexpr char decimal_digit_pairs[] =
+            "00010203040506070809"
+            "10111213141516171819"
+            "20212223242526272829"
+            "30313233343536373839"
+            "40414243444546474849"
+            "50515253545556575859"
+            "60616263646566676869"
+            "70717273747576777879"
+            "80818283848586878889"
+            "90919293949596979899";
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::uint32_t get_decimal_digit_count
+    (
+        std::uint64_t value
+    )
+    {
+        auto count = std::uint32_t(1);
+        for (auto threshold = std::uint64_t(10); ((count < 20) && (value >= threshold)); threshold *= 10)
+            ++count;
+        return count;
+    }
+
+
+    //=========================================================================
+    // writes exactly 'count' digits of value (zero padded on the left) ending at end
+    [[__maybe_unused__]]
+    static constexpr void write_decimal_digits
+    (
+        char * end,
+        std::uint64_t value,
+        std::uint32_t count
+    )
+    {
+        for (; count >= 2; count -= 2)
+        {
+            auto pair = (value % 100) * 2;
+            value /= 100;
+            *--end = decimal_digit_pairs[pair + 1];
+            *--end = decimal_digit_pairs[pair];
+        }
+        if (count > 0)
+            *--end = char('0' + (value % 10));
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars_decimal
+    (
+        char * first,
+        char * last,
+        std::unsigned_integral auto value
+    )
+    {
+        static_assert(sizeof(value) <= sizeof(std::uint64_t));
+        auto count = get_decimal_digit_count(value);
+        if ((last - first) < count)
+            return {last, std::errc::value_too_large};
+        write_decimal_digits(first + count, value, count);
+        return {first + count, std::errc()};
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars_decimal
+    (
+        char * first,
+        char * last,
+        std::signed_integral auto value
+    )
+    {
+        static_assert(sizeof(value) <= sizeof(std::uint64_t));
+        if (value >= 0)
+            return to_chars_decimal(first, last, std::uint64_t(value));
+        if (first == last)
+            return {last, std::errc::value_too_large};
+        *first = '-';
+        return to_chars_decimal(first + 1, last, std::uint64_t(0) - std::uint64_t(value));
+    }
+
+
+    //=========================================================================
+    // value * 10^-precision with exactly 'precision' fractional digits and at least one
+    // integer digit ("0.05").  the digits are written one position to the right and the
+    // integer digits then moved left over the gap to make room for the decimal point.
+    [[__maybe_unused__]]
+    static constexpr std::to_chars_result to_chars_fixed_point
+    (
+        char * first,
+        char * last,
+        std::unsigned_integral auto value,
+        std::uint32_t precision
+    )
+    {
+        static_assert(sizeof(value) <= sizeof(std::uint64_t));
+        if (precision == 0)
+            return to_chars_decimal(first, last, value);
+
+        auto digitCount = get_decimal_digit_count(value);
+        auto width = std::max(digitCount, precision + 1);
+        if ((last - first) < (width + 1))
+            return {last, std::errc::value_too_large};
+        std::fill_n(first + 1, width - digitCount, '0');
+        write_decimal_digits(first + 1 + width, value, digitCount);
+        auto integerCount = (width - precision);
+        for (auto i = 0u; i < integerCount; ++i)
+            first[i] = first[i + 1];
+        first[integerCount] = '.';
+        return {first + width + 1, std::errc()};
+    }
+
+} // namespace lime
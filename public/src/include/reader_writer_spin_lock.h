@@ -0,0 +1,230 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/non_copyable.h>
+#include <include/cache_line.h>
+#include <include/cpu_pause.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // reader writer spin lock for data which is read constantly and written rarely.
+    // readers are counted in N slots, each on its own cache line, and a thread always
+    // uses the same slot so that readers on different cores do not contend on a shared
+    // counter.  writers take precedence: once a writer is waiting new readers hold off
+    // until it has finished which prevents a steady stream of readers starving it.
+    //
+    // satisfies the std::shared_mutex interface (lock/unlock/try_lock and the _shared
+    // variants) so it can be used with std::unique_lock and std::shared_lock.  a shared
+    // lock must be released by the thread which took it.
+    template <std::size_t N = 64>
+    class reader_writer_spin_lock final :
+        non_copyable
+    {
+    public:
+
+        static auto constexpr reader_slot_count = N;
+        static auto constexpr maximum_backoff = 32u;
+
+        reader_writer_spin_lock() = default;
+        ~reader_writer_spin_lock() = default;
+
+        void lock();
+
+        void unlock();
+
+        bool try_lock();
+
+        void lock_shared();
+
+        void unlock_shared();
+
+        bool try_lock_shared();
+
+    private:
+
+        struct alignas(cache_line_size) reader_slot
+        {
+            std::atomic<std::uint32_t> count_{0};
+        };
+
+        static reader_slot & get_reader_slot
+        (
+            reader_writer_spin_lock &
+        );
+
+        bool has_readers() const;
+
+        alignas(cache_line_size) std::atomic<std::uint32_t>     writer_{0};
+        std::array<reader_slot, reader_slot_count>              readerSlots_;
+
+    }; // class reader_writer_spin_lock
+
+} // namespace lime
+
+
+//=============================================================================
+template <std::size_t N>
+inline auto lime::reader_writer_spin_lock<N>::get_reader_slot
+(
+    reader_writer_spin_lock & self
+) -> reader_slot &
+{
+    // threads are assigned slots round robin on first use
+    static std::atomic<std::size_t> nextSlotIndex{0};
+    static thread_local auto const slotIndex = (nextSlotIndex.fetch_add(1, std::memory_order_relaxed) % reader_slot_count);
+    return self.readerSlots_[slotIndex];
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline bool lime::reader_writer_spin_lock<N>::has_readers
+(
+) const
+{
+    // seq_cst (not just acquire) so that these loads take part in the single total order
+    // with the writer's claim and the readers' announcements (see lock_shared)
+    for (auto const & readerSlot : readerSlots_)
+        if (readerSlot.count_.load(std::memory_order_seq_cst) != 0)
+            return true;
+    return false;
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline void lime::reader_writer_spin_lock<N>::lock
+(
+)
+{
+    // claim the writer flag first (which stops new readers) then drain existing readers
+    auto backoff = 1u;
+    while (true)
+    {
+        std::uint32_t expected = 0;
+        if ((writer_.load(std::memory_order_relaxed) == 0) && 
+                (writer_.compare_exchange_weak(expected, 1, std::memory_order_seq_cst, std::memory_order_relaxed)))
+            break;
+        for (auto i = 0u; i < backoff; ++i)
+            cpu_pause();
+        backoff = std::min(backoff * 2, maximum_backoff);
+    }
+    while (has_readers())
+        cpu_pause();
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline void lime::reader_writer_spin_lock<N>::unlock
+(
+)
+{
+    writer_.store(0, std::memory_order_release);
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline bool lime::reader_writer_spin_lock<N>::try_lock
+(
+)
+{
+    std::uint32_t expected = 0;
+    if ((writer_.load(std::memory_order_relaxed) != 0) || 
+            (not writer_.compare_exchange_strong(expected, 1, std::memory_order_seq_cst, std::memory_order_relaxed)))
+        return false;
+    if (has_readers())
+    {
+        writer_.store(0, std::memory_order_release);
+        return false;
+    }
+    return true;
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline void lime::reader_writer_spin_lock<N>::lock_shared
+(
+)
+{
+    auto & readerSlot = get_reader_slot(*this);
+    while (true)
+    {
+        while (writer_.load(std::memory_order_relaxed) != 0)
+            cpu_pause();
+        // announce the reader then confirm that no writer arrived in the meantime.  both
+        // sides (this rmw and load, the writer's cas and its loads in has_readers) are
+        // seq_cst so that either this reader sees the writer or the writer sees this
+        // reader's count.
+        readerSlot.count_.fetch_add(1, std::memory_order_seq_cst);
+        if (writer_.load(std::memory_order_seq_cst) == 0)
+            return;
+        readerSlot.count_.fetch_sub(1, std::memory_order_release);
+    }
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline void lime::reader_writer_spin_lock<N>::unlock_shared
+(
+)
+{
+    get_reader_slot(*this).count_.fetch_sub(1, std::memory_order_release);
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline bool lime::reader_writer_spin_lock<N>::try_lock_shared
+(
+)
+{
+    if (writer_.load(std::memory_order_relaxed) != 0)
+        return false;
+    auto & readerSlot = get_reader_slot(*this);
+    readerSlot.count_.fetch_add(1, std::memory_order_seq_cst);
+    if (writer_.load(std::memory_order_seq_cst) == 0)
+        return true;
+    readerSlot.count_.fetch_sub(1, std::memory_order_release);
+    return false;
+}
@@ -0,0 +1,224 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/non_copyable.h>
+#include <include/cache_line.h>
+#include <include/cpu_pause.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // single writer, multiple reader snapshot.  the writer never waits and readers never
+    // write to shared memory: a reader copies the value and retries if the sequence shows
+    // that a store overlapped the copy.  intended for small values published frequently
+    // (top of book, positions) which are read far more often than they are written.
+    //
+    // the value is held as relaxed atomic words so that a torn read is well defined
+    // (and subsequently discarded) rather than a data race.
+    template <typename T>
+    requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+    class seqlock :
+        non_copyable
+    {
+    public:
+
+        using value_type = T;
+
+        seqlock() = default;
+
+        explicit seqlock
+        (
+            value_type const &
+        );
+
+        void store
+        (
+            value_type const &
+        );
+
+        template <typename F>
+        void update
+        (
+            F &&
+        );
+
+        value_type load() const;
+
+        bool try_load
+        (
+            value_type &
+        ) const;
+
+        std::uint64_t get_version() const;
+
+    private:
+
+        static auto constexpr word_count = ((sizeof(value_type) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t));
+
+        using words = std::array<std::uint64_t, word_count>;
+
+        bool try_read
+        (
+            words &
+        ) const;
+
+        // odd while a store is in progress
+        alignas(cache_line_size) std::atomic<std::uint64_t>     sequence_{0};
+        std::array<std::atomic<std::uint64_t>, word_count>      value_{};
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+lime::seqlock<T>::seqlock
+(
+    value_type const & value
+)
+{
+    store(value);
+}
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+inline void lime::seqlock<T>::store
+(
+    // writer only.  wait free.
+    value_type const & value
+)
+{
+    words source{};
+    std::memcpy(source.data(), &value, sizeof(value_type));
+
+    auto sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (auto i = 0ull; i < word_count; ++i)
+        value_[i].store(source[i], std::memory_order_relaxed);
+    sequence_.store(sequence + 2, std::memory_order_release);
+}
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+template <typename F>
+inline void lime::seqlock<T>::update
+(
+    // writer only.  modify the current value in place via f(value_type &)
+    F && modify
+)
+{
+    words current;
+    for (auto i = 0ull; i < word_count; ++i)
+        current[i] = value_[i].load(std::memory_order_relaxed);
+    value_type value;
+    std::memcpy(&value, current.data(), sizeof(value_type));
+    modify(value);
+    store(value);
+}
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+inline bool lime::seqlock<T>::try_read
+(
+    words & destination
+) const
+{
+    auto before = sequence_.load(std::memory_order_acquire);
+    if (before & 1)
+        return false;
+    for (auto i = 0ull; i < word_count; ++i)
+        destination[i] = value_[i].load(std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return (sequence_.load(std::memory_order_relaxed) == before);
+}
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+inline auto lime::seqlock<T>::load
+(
+    // retry until a consistent snapshot is read
+) const -> value_type
+{
+    words destination;
+    while (not try_read(destination))
+        cpu_pause();
+    value_type value;
+    std::memcpy(&value, destination.data(), sizeof(value_type));
+    return value;
+}
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+inline bool lime::seqlock<T>::try_load
+(
+    // single attempt.  returns false (leaving value unchanged) if a store overlapped the read
+    value_type & value
+) const
+{
+    words destination;
+    if (not try_read(destination))
+        return false;
+    std::memcpy(&value, destination.data(), sizeof(value_type));
+    return true;
+}
+
+
+//=============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>)
+inline std::uint64_t lime::seqlock<T>::get_version
+(
+    // number of completed stores.  lets a reader cheaply detect that nothing has changed
+) const
+{
+    return (sequence_.load(std::memory_order_acquire) / 2);
+}
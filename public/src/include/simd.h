@@ -0,0 +1,118 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // the widest vector instruction set batch kernels may use on this cpu.  kernels are
+    // compiled per instruction set using target attributes so the library itself can be
+    // built for a baseline cpu and still use wider vectors where they exist.
+    enum class simd_level : std::uint8_t
+    {
+        scalar  = 0,
+        avx2    = 1,
+        avx512  = 2     // avx512f, avx512dq and avx512vl
+    };
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static constexpr std::string_view to_string
+    (
+        simd_level simdLevel
+    )
+    {
+        switch (simdLevel)
+        {
+            case simd_level::scalar: return "scalar";
+            case simd_level::avx2: return "avx2";
+            case simd_level::avx512: return "avx512";
+        }
+        return "unknown";
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static simd_level detect_simd_level
+    (
+    )
+    {
+        #if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+                return simd_level::avx512;
+            if (__builtin_cpu_supports("avx2"))
+                return simd_level::avx2;
+        #endif
+        return simd_level::scalar;
+    }
+
+
+    //=========================================================================
+    // detected once.  set_simd_level() may lower it (for testing and benchmarking the
+    // narrower kernels) but never raises it above what the cpu supports.  inline rather
+    // than static so that there is one setting per program rather than per translation unit.
+    inline simd_level & get_simd_level_storage
+    (
+    )
+    {
+        static simd_level simdLevel = detect_simd_level();
+        return simdLevel;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static inline simd_level get_simd_level
+    (
+    )
+    {
+        return get_simd_level_storage();
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static inline void set_simd_level
+    (
+        simd_level simdLevel
+    )
+    {
+        get_simd_level_storage() = (simdLevel < detect_simd_level()) ? simdLevel : detect_simd_level();
+    }
+
+} // namespace lime
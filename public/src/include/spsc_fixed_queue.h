@@ -30,8 +30,11 @@ SOFTWARE.
 #pragma once
 
 #include "./non_copyable.h"
+#include "./wait_strategy.h"
 
+#include <atomic>
 #include <concepts>
+#include <memory>
 #include <cstddef>
 #include <vector>
 
@@ -39,21 +42,24 @@ SOFTWARE.
 namespace lime
 {
 
-    template <typename T>
+    template <typename T, wait_strategy_concept W = busy_spin_wait_strategy, typename A = std::allocator<T>>
     class spsc_fixed_queue : non_copyable
     {
     public:
 
         using type = T;
         using value_type = T;
+        using wait_strategy_type = W;
+        using allocator_type = A;
 
         spsc_fixed_queue
         (
-            std::size_t
+            std::size_t,
+            allocator_type const & = allocator_type()
         );
 
-        spsc_fixed_queue(spsc_fixed_queue &&) = default;
-        spsc_fixed_queue & operator = (spsc_fixed_queue &&) = default;
+        spsc_fixed_queue(spsc_fixed_queue &&);
+        spsc_fixed_queue & operator = (spsc_fixed_queue &&);
         ~spsc_fixed_queue() = default;
 
         type pop();
@@ -68,6 +74,13 @@ namespace lime
             type &
         );
 
+        std::size_t wait_pop
+        (
+            type &
+        );
+
+        void wait();
+
         template <typename T_>
         bool push
         (
@@ -94,27 +107,34 @@ namespace lime
 
     private:
 
-        std::size_t volatile        front_;
+        // published with release and observed with acquire so that the slot is visible
+        // before the index which covers it (and so that the futex wait strategy's check of
+        // the queue is part of its handshake rather than a data race)
+        std::atomic<std::size_t>    front_;
 
-        std::size_t volatile        back_;
+        std::atomic<std::size_t>    back_;
 
         std::size_t                 capacity_;
         std::size_t                 capacityMask_;
 
-        std::vector<type>           queue_;
+        std::vector<type, A>        queue_;
+
+        [[no_unique_address]] W     waitStrategy_;
     };
 
 } // namespace lime
 
 
 //==============================================================================
-template <typename T>
-lime::spsc_fixed_queue<T>::spsc_fixed_queue
+template <typename T, lime::wait_strategy_concept W, typename A>
+lime::spsc_fixed_queue<T, W, A>::spsc_fixed_queue
 (
-    std::size_t capacity
+    std::size_t capacity,
+    allocator_type const & allocator
 ):
     front_(0), 
-    back_(0)
+    back_(0),
+    queue_(allocator)
 {
     capacity_ = 1;
     while (capacity_ < capacity)
@@ -125,8 +145,45 @@ lime::spsc_fixed_queue<T>::spsc_fixed_queue
 
 
 //==============================================================================
-template <typename T>
-inline std::size_t lime::spsc_fixed_queue<T>::capacity
+template <typename T, lime::wait_strategy_concept W, typename A>
+lime::spsc_fixed_queue<T, W, A>::spsc_fixed_queue
+(
+    // moving is only meaningful while neither the producer nor the consumer is active
+    spsc_fixed_queue && other
+):
+    front_(other.front_.load(std::memory_order_relaxed)),
+    back_(other.back_.load(std::memory_order_relaxed)),
+    capacity_(other.capacity_),
+    capacityMask_(other.capacityMask_),
+    queue_(std::move(other.queue_)),
+    waitStrategy_(std::move(other.waitStrategy_))
+{
+}
+
+
+//==============================================================================
+template <typename T, lime::wait_strategy_concept W, typename A>
+auto lime::spsc_fixed_queue<T, W, A>::operator =
+(
+    spsc_fixed_queue && other
+) -> spsc_fixed_queue &
+{
+    if (this != &other)
+    {
+        front_.store(other.front_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        back_.store(other.back_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        capacity_ = other.capacity_;
+        capacityMask_ = other.capacityMask_;
+        queue_ = std::move(other.queue_);
+        waitStrategy_ = std::move(other.waitStrategy_);
+    }
+    return *this;
+}
+
+
+//==============================================================================
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline std::size_t lime::spsc_fixed_queue<T, W, A>::capacity
 (
 ) const
 {
@@ -135,76 +192,77 @@ inline std::size_t lime::spsc_fixed_queue<T>::capacity
 
 
 //==============================================================================
-template <typename T>
-T & lime::spsc_fixed_queue<T>::front
+template <typename T, lime::wait_strategy_concept W, typename A>
+T & lime::spsc_fixed_queue<T, W, A>::front
 (
 )
 {
-    return queue_[front_ & capacityMask_];
+    return queue_[front_.load(std::memory_order_relaxed) & capacityMask_];
 }
 
 
 //==============================================================================
-template <typename T>
-T const & lime::spsc_fixed_queue<T>::front
+template <typename T, lime::wait_strategy_concept W, typename A>
+T const & lime::spsc_fixed_queue<T, W, A>::front
 (
 ) const
 {
-    return queue_[front_ & capacityMask_];
+    return queue_[front_.load(std::memory_order_relaxed) & capacityMask_];
 }
 
 
 //==============================================================================
-template <typename T>
-inline auto lime::spsc_fixed_queue<T>::pop
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline auto lime::spsc_fixed_queue<T, W, A>::pop
 (
 ) -> type
 {
-    std::size_t front = front_;
+    auto front = front_.load(std::memory_order_relaxed);
     type ret = std::move(queue_[front++ & capacityMask_]);
-    front_ = front;
+    front_.store(front, std::memory_order_release);
     return ret;
 }
 
 
 //==============================================================================
-template <typename T>
-inline std::size_t lime::spsc_fixed_queue<T>::discard
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline std::size_t lime::spsc_fixed_queue<T, W, A>::discard
 (
 )
 {
-    queue_[front_ & capacityMask_] = {};
-    front_ = front_ + 1;
-    return (back_ - front_);
+    auto front = front_.load(std::memory_order_relaxed);
+    queue_[front++ & capacityMask_] = {};
+    front_.store(front, std::memory_order_release);
+    return (back_.load(std::memory_order_acquire) - front);
 }
 
 
 //==============================================================================
-template <typename T>
-inline std::size_t lime::spsc_fixed_queue<T>::pop
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline std::size_t lime::spsc_fixed_queue<T, W, A>::pop
 (
     type & value
 )
 {
-    auto front = front_;
-    auto size = (back_ - front);
+    auto front = front_.load(std::memory_order_relaxed);
+    auto size = (back_.load(std::memory_order_acquire) - front);
     value = std::move(queue_[front++ & capacityMask_]);
-    front_ = front;
+    front_.store(front, std::memory_order_release);
     return size;
 }
 
 
 //==============================================================================
-template <typename T>
-inline std::size_t lime::spsc_fixed_queue<T>::try_pop
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline std::size_t lime::spsc_fixed_queue<T, W, A>::try_pop
 (
     type & value
 )
 {
-    if (auto front = front_, size = (back_ - front); size > 0)
+    if (auto front = front_.load(std::memory_order_relaxed), size = (back_.load(std::memory_order_acquire) - front); size > 0)
     {
         value = std::move(queue_[front++ & capacityMask_]);
-        front_ = front;
+        front_.store(front, std::memory_order_release);
         return size;
     }
     return 0;
@@ -212,17 +270,41 @@ inline std::size_t lime::spsc_fixed_queue<T>::try_pop
 
 
 //==============================================================================
-template <typename T>
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline void lime::spsc_fixed_queue<T, W, A>::wait
+(
+    // consumer side.  wait, according to the wait strategy, until the queue is not empty
+)
+{
+    waitStrategy_.wait([this](){return (back_.load(std::memory_order_acquire) != front_.load(std::memory_order_relaxed));});
+}
+
+
+//==============================================================================
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline std::size_t lime::spsc_fixed_queue<T, W, A>::wait_pop
+(
+    type & value
+)
+{
+    wait();
+    return pop(value);
+}
+
+
+//==============================================================================
+template <typename T, lime::wait_strategy_concept W, typename A>
 template <typename ... Ts>
-inline bool lime::spsc_fixed_queue<T>::emplace
+inline bool lime::spsc_fixed_queue<T, W, A>::emplace
 (
     Ts && ... args
 )
 {
-    if (std::size_t back = back_; (back - front_) < capacity_)
+    if (auto back = back_.load(std::memory_order_relaxed); (back - front_.load(std::memory_order_acquire)) < capacity_)
     {
         queue_[back++ & capacityMask_] = T(std::forward<Ts>(args) ...);
-        back_ = back;
+        back_.store(back, std::memory_order_release);
+        waitStrategy_.notify();
         return true;
     }
     return false;
@@ -230,17 +312,18 @@ inline bool lime::spsc_fixed_queue<T>::emplace
 
 
 //==============================================================================
-template <typename T>
+template <typename T, lime::wait_strategy_concept W, typename A>
 template <typename T_>
-inline bool lime::spsc_fixed_queue<T>::push
+inline bool lime::spsc_fixed_queue<T, W, A>::push
 (
     T_ && value
 )
 {
-    if (std::size_t back = back_; (back - front_) < capacity_)
+    if (auto back = back_.load(std::memory_order_relaxed); (back - front_.load(std::memory_order_acquire)) < capacity_)
     {
         queue_[back++ & capacityMask_] = std::forward<T_>(value);
-        back_ = back;
+        back_.store(back, std::memory_order_release);
+        waitStrategy_.notify();
         return true;
     }
     return false;
@@ -248,20 +331,20 @@ inline bool lime::spsc_fixed_queue<T>::push
 
 
 //==============================================================================
-template <typename T>
-inline bool lime::spsc_fixed_queue<T>::empty
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline bool lime::spsc_fixed_queue<T, W, A>::empty
 (
 ) const
 {
-    return (back_ == front_);
+    return (back_.load(std::memory_order_acquire) == front_.load(std::memory_order_acquire));
 }
 
 
 //==============================================================================
-template <typename T>
-inline std::size_t lime::spsc_fixed_queue<T>::size
+template <typename T, lime::wait_strategy_concept W, typename A>
+inline std::size_t lime::spsc_fixed_queue<T, W, A>::size
 (
 ) const
 {
-    return (back_ - front_);
+    return (back_.load(std::memory_order_acquire) - front_.load(std::memory_order_acquire));
 }
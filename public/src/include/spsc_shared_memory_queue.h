@@ -0,0 +1,668 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./non_copyable.h"
+#include "./cache_line.h"
+#include "./huge_page_mode.h"
+#include "./bit.h"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // a single producer, single consumer queue whose indices and storage live in a
+    // shared memory segment so that the producer and consumer can be separate processes.
+    //
+    // the segment is either named (/dev/shm, or /dev/hugepages when using hugetlb) so that
+    // the peer can open it by name, or anonymous (memfd) in which case the peer maps it
+    // using a file descriptor passed to it (SCM_RIGHTS, fork, /proc/<pid>/fd/<n>).
+    //
+    // T must be trivially copyable as values are exchanged between address spaces.
+    template <typename T>
+    requires (std::is_trivially_copyable_v<T>)
+    class spsc_shared_memory_queue : non_copyable
+    {
+    public:
+
+        using type = T;
+        using value_type = T;
+
+        static std::optional<spsc_shared_memory_queue> create
+        (
+            std::string const &,
+            std::size_t,
+            huge_page_mode = huge_page_mode::none
+        );
+
+        static std::optional<spsc_shared_memory_queue> create
+        (
+            std::size_t,
+            huge_page_mode = huge_page_mode::none
+        );
+
+        static std::optional<spsc_shared_memory_queue> open
+        (
+            std::string const &,
+            huge_page_mode = huge_page_mode::none
+        );
+
+        static std::optional<spsc_shared_memory_queue> open
+        (
+            int
+        );
+
+        static bool unlink
+        (
+            std::string const &,
+            huge_page_mode = huge_page_mode::none
+        );
+
+        spsc_shared_memory_queue(spsc_shared_memory_queue &&);
+        spsc_shared_memory_queue & operator = (spsc_shared_memory_queue &&);
+        ~spsc_shared_memory_queue();
+
+        type pop();
+
+        std::size_t pop
+        (
+            type &
+        );
+
+        std::size_t try_pop
+        (
+            type &
+        );
+
+        template <typename T_>
+        bool push
+        (
+            T_ &&
+        );
+
+        template <typename ... Ts>
+        bool emplace
+        (
+            Ts && ...
+        );
+
+        T const & front() const;
+
+        T & front();
+
+        bool empty() const;
+
+        std::size_t capacity() const;
+
+        std::size_t size() const;
+
+        std::size_t discard();
+
+        int get_file_descriptor() const;
+
+    private:
+
+        static auto constexpr magic = std::uint64_t(0x6c696d6573707363); // "limespsc"
+
+        struct control_block
+        {
+            std::atomic<std::uint64_t>                          magic_;
+            std::uint64_t                                       capacity_;
+            std::uint64_t                                       elementSize_;
+            std::uint64_t                                       dataOffset_;
+            alignas(cache_line_size) std::atomic<std::size_t>   front_;
+            alignas(cache_line_size) std::atomic<std::size_t>   back_;
+        };
+
+        static_assert(std::atomic<std::size_t>::is_always_lock_free, "shared memory indices must be address free");
+
+        static auto constexpr data_offset = ((sizeof(control_block) + alignof(T) - 1) / alignof(T)) * alignof(T);
+
+        spsc_shared_memory_queue
+        (
+            int,
+            void *,
+            std::size_t
+        );
+
+        static std::string get_path
+        (
+            std::string const &,
+            huge_page_mode
+        );
+
+        static std::optional<spsc_shared_memory_queue> create
+        (
+            int,
+            std::size_t,
+            huge_page_mode
+        );
+
+        static std::optional<spsc_shared_memory_queue> map
+        (
+            int
+        );
+
+        void release();
+
+        int                         fileDescriptor_{-1};
+        std::size_t                 mappedSize_{0};
+        control_block *             controlBlock_{nullptr};
+        type *                      queue_{nullptr};
+
+        std::size_t                 capacity_{0};
+        std::size_t                 capacityMask_{0};
+
+        // each side's last observed value of the other side's index.  only refreshed
+        // when the queue appears full (producer) or empty (consumer) which keeps the
+        // peer's index line from being pulled across on every operation.
+        std::size_t                 cachedFront_{0};
+        std::size_t                 cachedBack_{0};
+    };
+
+} // namespace lime
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+lime::spsc_shared_memory_queue<T>::spsc_shared_memory_queue
+(
+    int fileDescriptor,
+    void * address,
+    std::size_t mappedSize
+):
+    fileDescriptor_(fileDescriptor),
+    mappedSize_(mappedSize),
+    controlBlock_(reinterpret_cast<control_block *>(address)),
+    queue_(reinterpret_cast<type *>(reinterpret_cast<char *>(address) + data_offset)),
+    capacity_(controlBlock_->capacity_),
+    capacityMask_(capacity_ - 1),
+    cachedFront_(controlBlock_->front_.load(std::memory_order_acquire)),
+    cachedBack_(controlBlock_->back_.load(std::memory_order_acquire))
+{
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+lime::spsc_shared_memory_queue<T>::spsc_shared_memory_queue
+(
+    spsc_shared_memory_queue && other
+):
+    fileDescriptor_(std::exchange(other.fileDescriptor_, -1)),
+    mappedSize_(std::exchange(other.mappedSize_, 0)),
+    controlBlock_(std::exchange(other.controlBlock_, nullptr)),
+    queue_(std::exchange(other.queue_, nullptr)),
+    capacity_(std::exchange(other.capacity_, 0)),
+    capacityMask_(std::exchange(other.capacityMask_, 0)),
+    cachedFront_(other.cachedFront_),
+    cachedBack_(other.cachedBack_)
+{
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::operator =
+(
+    spsc_shared_memory_queue && other
+) -> spsc_shared_memory_queue &
+{
+    if (this != &other)
+    {
+        release();
+        fileDescriptor_ = std::exchange(other.fileDescriptor_, -1);
+        mappedSize_ = std::exchange(other.mappedSize_, 0);
+        controlBlock_ = std::exchange(other.controlBlock_, nullptr);
+        queue_ = std::exchange(other.queue_, nullptr);
+        capacity_ = std::exchange(other.capacity_, 0);
+        capacityMask_ = std::exchange(other.capacityMask_, 0);
+        cachedFront_ = other.cachedFront_;
+        cachedBack_ = other.cachedBack_;
+    }
+    return *this;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+lime::spsc_shared_memory_queue<T>::~spsc_shared_memory_queue
+(
+)
+{
+    release();
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+void lime::spsc_shared_memory_queue<T>::release
+(
+)
+{
+    if (controlBlock_ != nullptr)
+        ::munmap(controlBlock_, mappedSize_);
+    if (fileDescriptor_ >= 0)
+        ::close(fileDescriptor_);
+    controlBlock_ = nullptr;
+    queue_ = nullptr;
+    fileDescriptor_ = -1;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+std::string lime::spsc_shared_memory_queue<T>::get_path
+(
+    std::string const & name,
+    huge_page_mode hugePageMode
+)
+{
+    // shm_open does not support hugetlb so explicit huge page segments are
+    // created directly on the hugetlbfs mount instead.
+    auto prefix = (hugePageMode == huge_page_mode::hugetlb) ? "/dev/hugepages/" : "/";
+    return prefix + name;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::create
+(
+    // create a named segment.  fails if a segment with the same name already exists.
+    std::string const & name,
+    std::size_t capacity,
+    huge_page_mode hugePageMode
+) -> std::optional<spsc_shared_memory_queue>
+{
+    static auto constexpr flags = (O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC);
+    static auto constexpr mode = (S_IRUSR | S_IWUSR);
+
+    auto path = get_path(name, hugePageMode);
+    auto fileDescriptor = (hugePageMode == huge_page_mode::hugetlb) ? 
+            ::open(path.c_str(), flags, mode) : ::shm_open(path.c_str(), flags, mode);
+    if (fileDescriptor < 0)
+        return std::nullopt;
+    if (auto queue = create(fileDescriptor, capacity, hugePageMode); queue)
+        return queue;
+    unlink(name, hugePageMode);
+    return std::nullopt;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::create
+(
+    // create an anonymous (memfd) segment.  the peer process maps it via get_file_descriptor().
+    std::size_t capacity,
+    huge_page_mode hugePageMode
+) -> std::optional<spsc_shared_memory_queue>
+{
+    static auto constexpr memfd_huge_2mb = (21u << 26); // MFD_HUGE_2MB
+
+    auto flags = MFD_CLOEXEC;
+    if (hugePageMode == huge_page_mode::hugetlb)
+        flags |= (MFD_HUGETLB | memfd_huge_2mb);
+    auto fileDescriptor = ::memfd_create("lime_spsc_shared_memory_queue", flags);
+    if (fileDescriptor < 0)
+        return std::nullopt;
+    return create(fileDescriptor, capacity, hugePageMode);
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::create
+(
+    int fileDescriptor,
+    std::size_t capacity,
+    huge_page_mode hugePageMode
+) -> std::optional<spsc_shared_memory_queue>
+{
+    capacity = minimum_power_of_two(std::max<std::size_t>(capacity, 1));
+    auto mappedSize = round_to_page_size(data_offset + (capacity * sizeof(T)), hugePageMode);
+    if (::ftruncate(fileDescriptor, mappedSize) != 0)
+    {
+        ::close(fileDescriptor);
+        return std::nullopt;
+    }
+
+    auto address = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fileDescriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        ::close(fileDescriptor);
+        return std::nullopt;
+    }
+    if (hugePageMode == huge_page_mode::transparent)
+        ::madvise(address, mappedSize, MADV_HUGEPAGE);
+
+    auto controlBlock = new (address) control_block;
+    controlBlock->capacity_ = capacity;
+    controlBlock->elementSize_ = sizeof(T);
+    controlBlock->dataOffset_ = data_offset;
+    controlBlock->front_.store(0, std::memory_order_relaxed);
+    controlBlock->back_.store(0, std::memory_order_relaxed);
+    // publish last.  a peer which maps the segment before this point sees no magic and fails to open
+    controlBlock->magic_.store(magic, std::memory_order_release);
+    return spsc_shared_memory_queue(fileDescriptor, address, mappedSize);
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::open
+(
+    std::string const & name,
+    huge_page_mode hugePageMode
+) -> std::optional<spsc_shared_memory_queue>
+{
+    static auto constexpr flags = (O_RDWR | O_CLOEXEC);
+
+    auto path = get_path(name, hugePageMode);
+    auto fileDescriptor = (hugePageMode == huge_page_mode::hugetlb) ? 
+            ::open(path.c_str(), flags) : ::shm_open(path.c_str(), flags, 0);
+    if (fileDescriptor < 0)
+        return std::nullopt;
+    auto queue = map(fileDescriptor);
+    if ((queue) && (hugePageMode == huge_page_mode::transparent))
+        ::madvise(queue->controlBlock_, queue->mappedSize_, MADV_HUGEPAGE);
+    return queue;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::open
+(
+    // map a segment from a file descriptor received from the creating process.
+    // the file descriptor is duplicated so the caller retains ownership of the original.
+    int fileDescriptor
+) -> std::optional<spsc_shared_memory_queue>
+{
+    if (fileDescriptor = ::fcntl(fileDescriptor, F_DUPFD_CLOEXEC, 0); fileDescriptor < 0)
+        return std::nullopt;
+    return map(fileDescriptor);
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+auto lime::spsc_shared_memory_queue<T>::map
+(
+    int fileDescriptor
+) -> std::optional<spsc_shared_memory_queue>
+{
+    struct stat status;
+    if ((::fstat(fileDescriptor, &status) != 0) || (std::size_t(status.st_size) < sizeof(control_block)))
+    {
+        ::close(fileDescriptor);
+        return std::nullopt;
+    }
+
+    std::size_t mappedSize = status.st_size;
+    auto address = ::mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fileDescriptor, 0);
+    if (address == MAP_FAILED)
+    {
+        ::close(fileDescriptor);
+        return std::nullopt;
+    }
+
+    // reject segments which are not yet initialized or were created for a different element type
+    auto const & controlBlock = *reinterpret_cast<control_block const *>(address);
+    if ((controlBlock.magic_.load(std::memory_order_acquire) != magic) || 
+        (controlBlock.elementSize_ != sizeof(T)) || 
+        (controlBlock.dataOffset_ != data_offset) ||
+        ((data_offset + (controlBlock.capacity_ * sizeof(T))) > mappedSize))
+    {
+        ::munmap(address, mappedSize);
+        ::close(fileDescriptor);
+        return std::nullopt;
+    }
+    return spsc_shared_memory_queue(fileDescriptor, address, mappedSize);
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+bool lime::spsc_shared_memory_queue<T>::unlink
+(
+    std::string const & name,
+    huge_page_mode hugePageMode
+)
+{
+    auto path = get_path(name, hugePageMode);
+    return (((hugePageMode == huge_page_mode::hugetlb) ? ::unlink(path.c_str()) : ::shm_unlink(path.c_str())) == 0);
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline int lime::spsc_shared_memory_queue<T>::get_file_descriptor
+(
+) const
+{
+    return fileDescriptor_;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline std::size_t lime::spsc_shared_memory_queue<T>::capacity
+(
+) const
+{
+    return capacity_;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline T & lime::spsc_shared_memory_queue<T>::front
+(
+)
+{
+    return queue_[controlBlock_->front_.load(std::memory_order_relaxed) & capacityMask_];
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline T const & lime::spsc_shared_memory_queue<T>::front
+(
+) const
+{
+    return queue_[controlBlock_->front_.load(std::memory_order_relaxed) & capacityMask_];
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline auto lime::spsc_shared_memory_queue<T>::pop
+(
+) -> type
+{
+    auto front = controlBlock_->front_.load(std::memory_order_relaxed);
+    type ret = queue_[front & capacityMask_];
+    controlBlock_->front_.store(front + 1, std::memory_order_release);
+    return ret;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline std::size_t lime::spsc_shared_memory_queue<T>::discard
+(
+)
+{
+    auto front = controlBlock_->front_.load(std::memory_order_relaxed) + 1;
+    controlBlock_->front_.store(front, std::memory_order_release);
+    return (controlBlock_->back_.load(std::memory_order_acquire) - front);
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline std::size_t lime::spsc_shared_memory_queue<T>::pop
+(
+    type & value
+)
+{
+    auto front = controlBlock_->front_.load(std::memory_order_relaxed);
+    auto size = (controlBlock_->back_.load(std::memory_order_acquire) - front);
+    value = queue_[front & capacityMask_];
+    controlBlock_->front_.store(front + 1, std::memory_order_release);
+    return size;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline std::size_t lime::spsc_shared_memory_queue<T>::try_pop
+(
+    type & value
+)
+{
+    auto front = controlBlock_->front_.load(std::memory_order_relaxed);
+    if (cachedBack_ == front)
+    {
+        cachedBack_ = controlBlock_->back_.load(std::memory_order_acquire);
+        if (cachedBack_ == front)
+            return 0;
+    }
+    auto size = (cachedBack_ - front);
+    value = queue_[front & capacityMask_];
+    controlBlock_->front_.store(front + 1, std::memory_order_release);
+    return size;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+template <typename ... Ts>
+inline bool lime::spsc_shared_memory_queue<T>::emplace
+(
+    Ts && ... args
+)
+{
+    auto back = controlBlock_->back_.load(std::memory_order_relaxed);
+    if ((back - cachedFront_) >= capacity_)
+    {
+        cachedFront_ = controlBlock_->front_.load(std::memory_order_acquire);
+        if ((back - cachedFront_) >= capacity_)
+            return false;
+    }
+    queue_[back & capacityMask_] = T(std::forward<Ts>(args) ...);
+    controlBlock_->back_.store(back + 1, std::memory_order_release);
+    return true;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+template <typename T_>
+inline bool lime::spsc_shared_memory_queue<T>::push
+(
+    T_ && value
+)
+{
+    auto back = controlBlock_->back_.load(std::memory_order_relaxed);
+    if ((back - cachedFront_) >= capacity_)
+    {
+        cachedFront_ = controlBlock_->front_.load(std::memory_order_acquire);
+        if ((back - cachedFront_) >= capacity_)
+            return false;
+    }
+    queue_[back & capacityMask_] = std::forward<T_>(value);
+    controlBlock_->back_.store(back + 1, std::memory_order_release);
+    return true;
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline bool lime::spsc_shared_memory_queue<T>::empty
+(
+) const
+{
+    return (controlBlock_->back_.load(std::memory_order_acquire) == controlBlock_->front_.load(std::memory_order_acquire));
+}
+
+
+//==============================================================================
+template <typename T>
+requires (std::is_trivially_copyable_v<T>)
+inline std::size_t lime::spsc_shared_memory_queue<T>::size
+(
+) const
+{
+    return (controlBlock_->back_.load(std::memory_order_acquire) - controlBlock_->front_.load(std::memory_order_acquire));
+}
@@ -0,0 +1,310 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./non_copyable.h"
+#include "./non_movable.h"
+#include "./cache_line.h"
+#include "./wait_strategy.h"
+#include "./bit.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // single producer, single consumer queue with a compile time capacity.  storage is
+    // inline (no pointer to chase) and index masking uses a constant so each operation
+    // touches only the indices and the slot.  the queue holds no pointers so it can be
+    // placed directly in shared memory or embedded in another structure.
+    template <typename T, std::size_t N, wait_strategy_concept W = busy_spin_wait_strategy>
+    class alignas(cache_line_size) spsc_static_queue :
+        non_copyable,
+        non_movable
+    {
+    public:
+
+        using type = T;
+        using value_type = T;
+        using wait_strategy_type = W;
+
+        static auto constexpr fixed_capacity = std::size_t(minimum_power_of_two(std::max<std::size_t>(N, 1)));
+        static auto constexpr capacity_mask = (fixed_capacity - 1);
+
+        spsc_static_queue() = default;
+        ~spsc_static_queue() = default;
+
+        type pop();
+
+        std::size_t pop
+        (
+            type &
+        );
+
+        std::size_t try_pop
+        (
+            type &
+        );
+
+        std::size_t wait_pop
+        (
+            type &
+        );
+
+        void wait();
+
+        template <typename T_>
+        bool push
+        (
+            T_ &&
+        );
+
+        template <typename ... Ts>
+        bool emplace
+        (
+            Ts && ...
+        );
+
+        T const & front() const;
+
+        T & front();
+
+        bool empty() const;
+
+        static constexpr std::size_t capacity();
+
+        std::size_t size() const;
+
+        std::size_t discard();
+
+    private:
+
+        // consumer owned line
+        alignas(cache_line_size) std::atomic<std::size_t>   front_{0};
+        std::size_t                                         cachedBack_{0};
+
+        // producer owned line
+        alignas(cache_line_size) std::atomic<std::size_t>   back_{0};
+        std::size_t                                         cachedFront_{0};
+
+        alignas(cache_line_size) std::array<type, fixed_capacity> queue_{};
+
+        [[no_unique_address]] W                             waitStrategy_;
+    };
+
+} // namespace lime
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+constexpr std::size_t lime::spsc_static_queue<T, N, W>::capacity
+(
+)
+{
+    return fixed_capacity;
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline T & lime::spsc_static_queue<T, N, W>::front
+(
+)
+{
+    return queue_[front_.load(std::memory_order_relaxed) & capacity_mask];
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline T const & lime::spsc_static_queue<T, N, W>::front
+(
+) const
+{
+    return queue_[front_.load(std::memory_order_relaxed) & capacity_mask];
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline auto lime::spsc_static_queue<T, N, W>::pop
+(
+) -> type
+{
+    auto front = front_.load(std::memory_order_relaxed);
+    type ret = std::move(queue_[front & capacity_mask]);
+    front_.store(front + 1, std::memory_order_release);
+    return ret;
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline std::size_t lime::spsc_static_queue<T, N, W>::discard
+(
+)
+{
+    auto front = front_.load(std::memory_order_relaxed);
+    queue_[front++ & capacity_mask] = {};
+    front_.store(front, std::memory_order_release);
+    return (back_.load(std::memory_order_acquire) - front);
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline std::size_t lime::spsc_static_queue<T, N, W>::pop
+(
+    type & value
+)
+{
+    auto front = front_.load(std::memory_order_relaxed);
+    auto size = (back_.load(std::memory_order_acquire) - front);
+    value = std::move(queue_[front & capacity_mask]);
+    front_.store(front + 1, std::memory_order_release);
+    return size;
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline std::size_t lime::spsc_static_queue<T, N, W>::try_pop
+(
+    type & value
+)
+{
+    auto front = front_.load(std::memory_order_relaxed);
+    if (cachedBack_ == front)
+    {
+        // only read the producer's line when the queue appears empty
+        cachedBack_ = back_.load(std::memory_order_acquire);
+        if (cachedBack_ == front)
+            return 0;
+    }
+    auto size = (cachedBack_ - front);
+    value = std::move(queue_[front & capacity_mask]);
+    front_.store(front + 1, std::memory_order_release);
+    return size;
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline void lime::spsc_static_queue<T, N, W>::wait
+(
+    // consumer side.  wait, according to the wait strategy, until the queue is not empty
+)
+{
+    waitStrategy_.wait([this](){return (back_.load(std::memory_order_acquire) != front_.load(std::memory_order_relaxed));});
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline std::size_t lime::spsc_static_queue<T, N, W>::wait_pop
+(
+    type & value
+)
+{
+    wait();
+    return pop(value);
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+template <typename ... Ts>
+inline bool lime::spsc_static_queue<T, N, W>::emplace
+(
+    Ts && ... args
+)
+{
+    auto back = back_.load(std::memory_order_relaxed);
+    if ((back - cachedFront_) >= fixed_capacity)
+    {
+        // only read the consumer's line when the queue appears full
+        cachedFront_ = front_.load(std::memory_order_acquire);
+        if ((back - cachedFront_) >= fixed_capacity)
+            return false;
+    }
+    queue_[back & capacity_mask] = T(std::forward<Ts>(args) ...);
+    back_.store(back + 1, std::memory_order_release);
+    waitStrategy_.notify();
+    return true;
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+template <typename T_>
+inline bool lime::spsc_static_queue<T, N, W>::push
+(
+    T_ && value
+)
+{
+    auto back = back_.load(std::memory_order_relaxed);
+    if ((back - cachedFront_) >= fixed_capacity)
+    {
+        cachedFront_ = front_.load(std::memory_order_acquire);
+        if ((back - cachedFront_) >= fixed_capacity)
+            return false;
+    }
+    queue_[back & capacity_mask] = std::forward<T_>(value);
+    back_.store(back + 1, std::memory_order_release);
+    waitStrategy_.notify();
+    return true;
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline bool lime::spsc_static_queue<T, N, W>::empty
+(
+) const
+{
+    return (back_.load(std::memory_order_acquire) == front_.load(std::memory_order_acquire));
+}
+
+
+//==============================================================================
+template <typename T, std::size_t N, lime::wait_strategy_concept W>
+inline std::size_t lime::spsc_static_queue<T, N, W>::size
+(
+) const
+{
+    return (back_.load(std::memory_order_acquire) - front_.load(std::memory_order_acquire));
+}
@@ -0,0 +1,347 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./trade_statistics.h"
+#include <include/symbol_directory.h>
+#include <include/cache_line.h>
+#include <include/type_rich.h>
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // the OHLCV bars of every symbol for one interval as columns indexed by symbol id.
+    // prices are in the fixed_price's underlying units.  symbols without trades in the
+    // interval have zero volume and trades and all four prices equal to their previous close
+    // (zero if they have never traded).  vwap is zero for symbols without volume.
+    template <fixed_price_concept P, chrono_duration_concept D, typename A = std::allocator<typename P::value_type>>
+    struct bar_columns
+    {
+        using price_type = P;
+        using value_type = typename P::value_type;
+        using time_type = duration_since_midnight<D>;
+        template <typename T> using column = std::vector<T, typename std::allocator_traits<A>::template rebind_alloc<T>>;
+
+        explicit bar_columns
+        (
+            std::size_t symbolCount,
+            A const & allocator = A()
+        ):
+            open_(symbolCount, allocator),
+            high_(symbolCount, allocator),
+            low_(symbolCount, allocator),
+            close_(symbolCount, allocator),
+            vwap_(symbolCount, allocator),
+            volume_(symbolCount, allocator),
+            tradeCount_(symbolCount, allocator)
+        {
+        }
+
+        time_type                   start_;
+        time_type                   end_;
+        column<value_type>          open_;
+        column<value_type>          high_;
+        column<value_type>          low_;
+        column<value_type>          close_;
+        column<value_type>          vwap_;
+        column<std::uint64_t>       volume_;
+        column<std::uint32_t>       tradeCount_;
+    };
+
+
+    //=========================================================================
+    // builds fixed interval OHLCV bars for many symbols at once from a stream of trades.
+    // intervals are aligned to multiples of the interval since midnight.  the bars being
+    // built are kept one cache line per symbol so a trade touches one line, and are
+    // transposed into bar_columns when the interval completes (the first trade or advance
+    // at or after its end).  intervals without any trades are not reported.
+    //
+    // the completed interval is available from get_bars() after update(), advance() or
+    // flush() returns true and remains valid until the next interval completes.  trades
+    // with a time before the interval being built are counted in that interval.  symbol
+    // ids must be less than the symbol count given at construction.
+    template <fixed_price_concept P = fixed_price<4>, chrono_duration_concept D = std::chrono::nanoseconds,
+            type_rich_concept I = symbol_id, typename A = std::allocator<typename P::value_type>>
+    class bar_builder
+    {
+    public:
+
+        using price_type = P;
+        using shares_type = shares<std::uint64_t>;
+        using time_type = duration_since_midnight<D>;
+        using symbol_id_type = I;
+        using bar_columns_type = bar_columns<P, D, A>;
+
+        bar_builder
+        (
+            D,
+            std::size_t,
+            A const & = A()
+        );
+
+        bool update
+        (
+            symbol_id_type,
+            price_type,
+            shares_type,
+            time_type
+        );
+
+        template <std::integral T0, std::integral T1>
+        bool update
+        (
+            symbol_id_type,
+            trade_price<T0> const &,
+            trade_shares<T1> const &,
+            time_type
+        );
+
+        // completes the interval being built if the time is at or after its end
+        bool advance
+        (
+            time_type
+        );
+
+        // completes the interval being built regardless of the time (end of session)
+        bool flush();
+
+        bar_columns_type const & get_bars() const;
+
+        D get_interval() const;
+
+        std::size_t get_symbol_count() const;
+
+    private:
+
+        using value_type = typename price_type::value_type;
+        using time_value_type = typename D::rep;
+
+        struct alignas(cache_line_size) bar
+        {
+            unsigned __int128   notional_{0};
+            value_type          open_{0};
+            value_type          high_{0};
+            value_type          low_{std::numeric_limits<value_type>::max()};
+            value_type          close_{0};
+            std::uint64_t       volume_{0};
+            std::uint32_t       tradeCount_{0};
+        };
+
+        void complete();
+
+        void start
+        (
+            time_value_type
+        );
+
+        time_value_type                 interval_;
+
+        time_value_type                 intervalStart_{0};
+
+        time_value_type                 intervalEnd_{std::numeric_limits<time_value_type>::min()};
+
+        std::uint64_t                   tradeCount_{0};
+
+        typename bar_columns_type::template column<bar> bars_;
+
+        typename bar_columns_type::template column<value_type> previousClose_;
+
+        bar_columns_type                completed_;
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+lime::bar_builder<P, D, I, A>::bar_builder
+(
+    D interval,
+    std::size_t symbolCount,
+    A const & allocator
+):
+    interval_(std::max<time_value_type>(interval.count(), 1)),
+    bars_(symbolCount, allocator),
+    previousClose_(symbolCount, allocator),
+    completed_(symbolCount, allocator)
+{
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline void lime::bar_builder<P, D, I, A>::start
+(
+    time_value_type time
+)
+{
+    intervalStart_ = ((time / interval_) * interval_);
+    intervalEnd_ = (intervalStart_ + interval_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+void lime::bar_builder<P, D, I, A>::complete
+(
+    // transposes the bars into the columns, carrying the previous close forward for
+    // symbols without trades, and resets the bars for the next interval
+)
+{
+    completed_.start_ = time_type(D(intervalStart_));
+    completed_.end_ = time_type(D(intervalEnd_));
+    for (auto i = 0ull; i < bars_.size(); ++i)
+    {
+        auto & bar = bars_[i];
+        auto traded = (bar.tradeCount_ != 0);
+        auto previousClose = previousClose_[i];
+        completed_.open_[i] = traded ? bar.open_ : previousClose;
+        completed_.high_[i] = traded ? bar.high_ : previousClose;
+        completed_.low_[i] = traded ? bar.low_ : previousClose;
+        completed_.close_[i] = previousClose_[i] = (traded ? bar.close_ : previousClose);
+        completed_.vwap_[i] = (bar.volume_ == 0) ? 0 : value_type((bar.notional_ + (bar.volume_ / 2)) / bar.volume_);
+        completed_.volume_[i] = bar.volume_;
+        completed_.tradeCount_[i] = bar.tradeCount_;
+        bar = {};
+    }
+    tradeCount_ = 0;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline bool lime::bar_builder<P, D, I, A>::advance
+(
+    time_type time
+)
+{
+    auto now = time.get().count();
+    if (now < intervalEnd_)
+        return false;
+    auto completed = (tradeCount_ != 0);
+    if (completed)
+        complete();
+    start(now);
+    return completed;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline bool lime::bar_builder<P, D, I, A>::update
+(
+    symbol_id_type symbolId,
+    price_type price,
+    shares_type shares,
+    time_type time
+)
+{
+    auto completed = advance(time);
+    auto value = price.get_underlying_value();
+    auto & bar = bars_[symbolId.get()];
+    bar.open_ = (bar.tradeCount_ == 0) ? value : bar.open_;
+    bar.high_ = std::max(bar.high_, value);
+    bar.low_ = std::min(bar.low_, value);
+    bar.close_ = value;
+    bar.volume_ += shares.get();
+    bar.notional_ += static_cast<unsigned __int128>(value) * shares.get();
+    ++bar.tradeCount_;
+    ++tradeCount_;
+    return completed;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+template <std::integral T0, std::integral T1>
+inline bool lime::bar_builder<P, D, I, A>::update
+(
+    symbol_id_type symbolId,
+    trade_price<T0> const & price,
+    trade_shares<T1> const & shares,
+    time_type time
+)
+{
+    return update(symbolId, price_type(price.get()), shares_type(shares.get().get()), time);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline bool lime::bar_builder<P, D, I, A>::flush
+(
+)
+{
+    if (tradeCount_ == 0)
+        return false;
+    complete();
+    return true;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline auto lime::bar_builder<P, D, I, A>::get_bars
+(
+) const -> bar_columns_type const &
+{
+    return completed_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline auto lime::bar_builder<P, D, I, A>::get_interval
+(
+) const -> D
+{
+    return D(interval_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D, lime::type_rich_concept I, typename A>
+inline auto lime::bar_builder<P, D, I, A>::get_symbol_count
+(
+) const -> std::size_t
+{
+    return bars_.size();
+}
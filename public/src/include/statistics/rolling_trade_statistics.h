@@ -0,0 +1,522 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./trade_statistics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // vwap, twap, volume, notional, high and low of the trades within a rolling time window.
+    // the window is divided into buckets, each of which keeps the sums of the trades (and of
+    // the time weighted last price) within it.  the window's sums are kept as running totals
+    // to which each trade adds and from which each bucket is subtracted as it leaves the
+    // window.  high and low are kept in monotonic queues of per bucket extremes.  an update
+    // is O(1) (amortized over the buckets passed) and the memory is fixed by the bucket count.
+    //
+    // the window is the current bucket and the bucket_count - 1 buckets preceding it so the
+    // trailing edge moves in steps of one bucket.  times earlier than the latest time seen
+    // are treated as the latest time.
+    template <fixed_price_concept P = fixed_price<4>, chrono_duration_concept D = std::chrono::nanoseconds>
+    class rolling_trade_statistics
+    {
+    public:
+
+        using price_type = P;
+        using shares_type = shares<std::uint64_t>;
+        using time_type = duration_since_midnight<D>;
+        using notional_type = notional<P::precision>;
+
+        static auto constexpr default_bucket_count = std::size_t(60);
+
+        explicit rolling_trade_statistics
+        (
+            D,
+            std::size_t = default_bucket_count
+        );
+
+        void update
+        (
+            price_type,
+            shares_type,
+            time_type
+        );
+
+        template <std::integral T0, std::integral T1>
+        void update
+        (
+            trade_price<T0> const &,
+            trade_shares<T1> const &,
+            time_type
+        );
+
+        // moves the window to the given time without a trade
+        void advance
+        (
+            time_type
+        );
+
+        std::optional<price_type> get_vwap() const;
+
+        // as of the latest update or advance
+        std::optional<price_type> get_twap() const;
+
+        std::optional<price_type> get_high() const;
+
+        std::optional<price_type> get_low() const;
+
+        std::optional<price_type> get_last() const;
+
+        shares_type get_volume() const;
+
+        notional_type get_notional() const;
+
+        std::uint64_t get_trade_count() const;
+
+        D get_window() const;
+
+        void clear();
+
+    private:
+
+        using value_type = typename price_type::value_type;
+        using time_value_type = typename D::rep;
+
+        struct totals
+        {
+            wide_integer    notional_{0};
+            wide_integer    timeWeightedSum_{0};
+            std::uint64_t   weightedTime_{0};
+            std::uint64_t   volume_{0};
+            std::uint64_t   tradeCount_{0};
+        };
+
+        struct extreme
+        {
+            time_value_type bucket_;
+            value_type      value_;
+        };
+
+        // ring of at most one extreme per bucket in the window, values monotonic from
+        // the front (the window's extreme) to the back (the current bucket)
+        class extreme_queue
+        {
+        public:
+
+            explicit extreme_queue(std::size_t capacity):extremes_(capacity){}
+
+            template <typename F>
+            void push(time_value_type, value_type, F &&);
+
+            void expire(time_value_type);
+
+            bool empty() const{return (front_ == back_);}
+
+            value_type front() const{return extremes_[front_ % extremes_.size()].value_;}
+
+            void clear(){front_ = back_ = 0;}
+
+        private:
+
+            std::vector<extreme>    extremes_;
+
+            std::size_t             front_{0};
+
+            std::size_t             back_{0};
+        };
+
+        static price_type to_price
+        (
+            value_type
+        );
+
+        void hold_last_price
+        (
+            time_value_type
+        );
+
+        void advance_to
+        (
+            time_value_type
+        );
+
+        void reset
+        (
+            time_value_type
+        );
+
+        time_value_type             bucketDuration_;
+
+        std::vector<totals>         buckets_;
+
+        totals                      window_;
+
+        extreme_queue               highs_;
+
+        extreme_queue               lows_;
+
+        time_value_type             currentBucket_{0};
+
+        time_value_type             nextBucketStart_{0};
+
+        time_value_type             lastTime_{0};
+
+        value_type                  last_{0};
+
+        bool                        hasLast_{false};
+
+        bool                        started_{false};
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+template <typename F>
+inline void lime::rolling_trade_statistics<P, D>::extreme_queue::push
+(
+    // the function orders values with the extreme first.  a bucket which already has an
+    // extreme at least as extreme as the value keeps it.
+    time_value_type bucket,
+    value_type value,
+    F && isMoreExtreme
+)
+{
+    while ((back_ != front_) && !isMoreExtreme(extremes_[(back_ - 1) % extremes_.size()].value_, value))
+        --back_;
+    if ((back_ != front_) && (extremes_[(back_ - 1) % extremes_.size()].bucket_ == bucket))
+        return;
+    extremes_[back_++ % extremes_.size()] = {bucket, value};
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline void lime::rolling_trade_statistics<P, D>::extreme_queue::expire
+(
+    // removes extremes of buckets before the given bucket
+    time_value_type bucket
+)
+{
+    while ((front_ != back_) && (extremes_[front_ % extremes_.size()].bucket_ < bucket))
+        ++front_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+lime::rolling_trade_statistics<P, D>::rolling_trade_statistics
+(
+    D window,
+    std::size_t bucketCount
+):
+    bucketDuration_(std::max<time_value_type>(window.count() / time_value_type(std::max<std::size_t>(bucketCount, 1)), 1)),
+    buckets_(std::max<std::size_t>(bucketCount, 1)),
+    highs_(buckets_.size()),
+    lows_(buckets_.size())
+{
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::to_price
+(
+    value_type value
+) -> price_type
+{
+    return price_type(price<value_type>(value, price_type::precision));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline void lime::rolling_trade_statistics<P, D>::hold_last_price
+(
+    // credits the last price with the time from the latest time to the given time, which
+    // is within the current bucket
+    time_value_type time
+)
+{
+    if (hasLast_ && (time > lastTime_))
+    {
+        auto elapsed = std::uint64_t(time - lastTime_);
+        auto weightedPrice = wide_integer(last_) * elapsed;
+        auto & bucket = buckets_[std::uint64_t(currentBucket_) % buckets_.size()];
+        bucket.timeWeightedSum_ += weightedPrice;
+        bucket.weightedTime_ += elapsed;
+        window_.timeWeightedSum_ += weightedPrice;
+        window_.weightedTime_ += elapsed;
+    }
+    lastTime_ = std::max(lastTime_, time);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+void lime::rolling_trade_statistics<P, D>::reset
+(
+    // empties the window and starts it at the bucket of the given time
+    time_value_type time
+)
+{
+    std::fill(buckets_.begin(), buckets_.end(), totals{});
+    window_ = totals{};
+    highs_.clear();
+    lows_.clear();
+    currentBucket_ = (time / bucketDuration_);
+    nextBucketStart_ = ((currentBucket_ + 1) * bucketDuration_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+void lime::rolling_trade_statistics<P, D>::advance_to
+(
+    // the common case of a time within the current bucket costs a compare.  otherwise the
+    // buckets between are closed, and any which fall out of the window are subtracted.
+    time_value_type time
+)
+{
+    if (!started_)
+    {
+        started_ = true;
+        reset(time);
+        lastTime_ = time;
+        return;
+    }
+    time = std::max(time, lastTime_);
+    if (time < nextBucketStart_)
+    {
+        hold_last_price(time);
+        return;
+    }
+
+    auto bucket = (time / bucketDuration_);
+    if ((bucket - currentBucket_) >= time_value_type(buckets_.size()))
+    {
+        // the whole window has passed.  the last price is held from the start of
+        // the bucket which is the earliest the window now reaches.
+        auto windowStart = ((bucket - time_value_type(buckets_.size()) + 1) * bucketDuration_);
+        reset(windowStart);
+        lastTime_ = windowStart;
+    }
+    while (currentBucket_ < bucket)
+    {
+        hold_last_price(nextBucketStart_);
+        ++currentBucket_;
+        nextBucketStart_ += bucketDuration_;
+        auto & expired = buckets_[std::uint64_t(currentBucket_) % buckets_.size()];
+        window_.notional_ -= expired.notional_;
+        window_.timeWeightedSum_ -= expired.timeWeightedSum_;
+        window_.weightedTime_ -= expired.weightedTime_;
+        window_.volume_ -= expired.volume_;
+        window_.tradeCount_ -= expired.tradeCount_;
+        expired = totals{};
+    }
+    auto firstBucket = (currentBucket_ - time_value_type(buckets_.size()) + 1);
+    highs_.expire(firstBucket);
+    lows_.expire(firstBucket);
+    hold_last_price(time);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline void lime::rolling_trade_statistics<P, D>::update
+(
+    price_type price,
+    shares_type shares,
+    time_type time
+)
+{
+    advance_to(time.get().count());
+    auto value = price.get_underlying_value();
+    auto notional = wide_integer(value) * shares.get();
+    auto & bucket = buckets_[std::uint64_t(currentBucket_) % buckets_.size()];
+    bucket.notional_ += notional;
+    bucket.volume_ += shares.get();
+    ++bucket.tradeCount_;
+    window_.notional_ += notional;
+    window_.volume_ += shares.get();
+    ++window_.tradeCount_;
+    highs_.push(currentBucket_, value, [](auto a, auto b){return (a > b);});
+    lows_.push(currentBucket_, value, [](auto a, auto b){return (a < b);});
+    last_ = value;
+    hasLast_ = true;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+template <std::integral T0, std::integral T1>
+inline void lime::rolling_trade_statistics<P, D>::update
+(
+    trade_price<T0> const & price,
+    trade_shares<T1> const & shares,
+    time_type time
+)
+{
+    update(price_type(price.get()), shares_type(shares.get().get()), time);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline void lime::rolling_trade_statistics<P, D>::advance
+(
+    time_type time
+)
+{
+    advance_to(time.get().count());
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_vwap
+(
+) const -> std::optional<price_type>
+{
+    if (window_.volume_ == 0)
+        return std::nullopt;
+    return get_weighted_average<price_type>(window_.notional_, window_.volume_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_twap
+(
+    // the last price if no time has elapsed in the window since the first trade
+) const -> std::optional<price_type>
+{
+    if (!hasLast_)
+        return std::nullopt;
+    if (window_.weightedTime_ == 0)
+        return to_price(last_);
+    return get_weighted_average<price_type>(window_.timeWeightedSum_, window_.weightedTime_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_high
+(
+) const -> std::optional<price_type>
+{
+    return highs_.empty() ? std::nullopt : std::optional<price_type>(to_price(highs_.front()));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_low
+(
+) const -> std::optional<price_type>
+{
+    return lows_.empty() ? std::nullopt : std::optional<price_type>(to_price(lows_.front()));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_last
+(
+    // the last trade price even if it is no longer within the window
+) const -> std::optional<price_type>
+{
+    return hasLast_ ? std::optional<price_type>(to_price(last_)) : std::nullopt;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_volume
+(
+) const -> shares_type
+{
+    return shares_type(window_.volume_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_notional
+(
+) const -> notional_type
+{
+    return notional_type::from_wide_integer(window_.notional_, price_type::precision);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_trade_count
+(
+) const -> std::uint64_t
+{
+    return window_.tradeCount_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::rolling_trade_statistics<P, D>::get_window
+(
+) const -> D
+{
+    return D(bucketDuration_ * time_value_type(buckets_.size()));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+void lime::rolling_trade_statistics<P, D>::clear
+(
+)
+{
+    reset(0);
+    lastTime_ = 0;
+    last_ = 0;
+    hasLast_ = false;
+    started_ = false;
+}
@@ -0,0 +1,313 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/quotation.h>
+#include <include/duration.h>
+
+#include <algorithm>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // sum / weight rounded to nearest as a fixed_price.  both are in units of the fixed_price's
+    // underlying value so the average is formed with one (128 bit) division when it is read.
+    template <fixed_price_concept P>
+    [[__maybe_unused__]]
+    static constexpr P get_weighted_average
+    (
+        wide_integer sum,
+        std::uint64_t weight
+    )
+    {
+        using value_type = typename P::value_type;
+        auto average = ((static_cast<unsigned __int128>(sum) + (weight / 2)) / weight);
+        return P(price<value_type>(value_type(average), P::precision));
+    }
+
+
+    //=========================================================================
+    // statistics of all trades since construction (or clear()), updated in O(1) per trade with
+    // integer accumulators in the fixed_price's underlying units: vwap, twap, volume, notional,
+    // open, high, low and last.  the twap weights each price by how long it was the last trade
+    // price.  trades reported with a time earlier than the previous trade are treated as
+    // occurring at the time of the previous trade.
+    template <fixed_price_concept P = fixed_price<4>, chrono_duration_concept D = std::chrono::nanoseconds>
+    class trade_statistics
+    {
+    public:
+
+        using price_type = P;
+        using shares_type = shares<std::uint64_t>;
+        using time_type = duration_since_midnight<D>;
+        using notional_type = notional<P::precision>;
+
+        trade_statistics() = default;
+
+        void update
+        (
+            price_type,
+            shares_type,
+            time_type
+        );
+
+        template <std::integral T0, std::integral T1>
+        void update
+        (
+            trade_price<T0> const &,
+            trade_shares<T1> const &,
+            time_type
+        );
+
+        std::optional<price_type> get_vwap() const;
+
+        // the twap up to the given time with the last price held until then
+        std::optional<price_type> get_twap
+        (
+            time_type
+        ) const;
+
+        std::optional<price_type> get_open() const;
+
+        std::optional<price_type> get_high() const;
+
+        std::optional<price_type> get_low() const;
+
+        std::optional<price_type> get_last() const;
+
+        shares_type get_volume() const;
+
+        notional_type get_notional() const;
+
+        std::uint64_t get_trade_count() const;
+
+        void clear();
+
+    private:
+
+        using value_type = typename price_type::value_type;
+        using time_value_type = typename D::rep;
+
+        static price_type to_price
+        (
+            value_type
+        );
+
+        wide_integer    notional_{0};
+
+        wide_integer    timeWeightedSum_{0};
+
+        std::uint64_t   volume_{0};
+
+        std::uint64_t   tradeCount_{0};
+
+        value_type      open_{0};
+
+        value_type      high_{0};
+
+        value_type      low_{0};
+
+        value_type      last_{0};
+
+        time_value_type firstTime_{0};
+
+        time_value_type lastTime_{0};
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::to_price
+(
+    value_type value
+) -> price_type
+{
+    return price_type(price<value_type>(value, price_type::precision));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline void lime::trade_statistics<P, D>::update
+(
+    price_type price,
+    shares_type shares,
+    time_type time
+)
+{
+    auto value = price.get_underlying_value();
+    auto now = std::max(time.get().count(), lastTime_);
+    if (tradeCount_++ == 0)
+    {
+        open_ = high_ = low_ = value;
+        firstTime_ = now = time.get().count();
+    }
+    else
+    {
+        timeWeightedSum_ += wide_integer(last_) * (now - lastTime_);
+        high_ = std::max(high_, value);
+        low_ = std::min(low_, value);
+    }
+    notional_ += wide_integer(value) * shares.get();
+    volume_ += shares.get();
+    last_ = value;
+    lastTime_ = now;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+template <std::integral T0, std::integral T1>
+inline void lime::trade_statistics<P, D>::update
+(
+    trade_price<T0> const & price,
+    trade_shares<T1> const & shares,
+    time_type time
+)
+{
+    update(price_type(price.get()), shares_type(shares.get().get()), time);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_vwap
+(
+) const -> std::optional<price_type>
+{
+    if (volume_ == 0)
+        return std::nullopt;
+    return get_weighted_average<price_type>(notional_, volume_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_twap
+(
+    // the last price if no time has elapsed since the first trade
+    time_type time
+) const -> std::optional<price_type>
+{
+    if (tradeCount_ == 0)
+        return std::nullopt;
+    auto now = std::max(time.get().count(), lastTime_);
+    if (now == firstTime_)
+        return to_price(last_);
+    return get_weighted_average<price_type>(timeWeightedSum_ + (wide_integer(last_) * (now - lastTime_)), std::uint64_t(now - firstTime_));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_open
+(
+) const -> std::optional<price_type>
+{
+    return (tradeCount_ == 0) ? std::nullopt : std::optional<price_type>(to_price(open_));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_high
+(
+) const -> std::optional<price_type>
+{
+    return (tradeCount_ == 0) ? std::nullopt : std::optional<price_type>(to_price(high_));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_low
+(
+) const -> std::optional<price_type>
+{
+    return (tradeCount_ == 0) ? std::nullopt : std::optional<price_type>(to_price(low_));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_last
+(
+) const -> std::optional<price_type>
+{
+    return (tradeCount_ == 0) ? std::nullopt : std::optional<price_type>(to_price(last_));
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_volume
+(
+) const -> shares_type
+{
+    return shares_type(volume_);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_notional
+(
+) const -> notional_type
+{
+    return notional_type::from_wide_integer(notional_, price_type::precision);
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline auto lime::trade_statistics<P, D>::get_trade_count
+(
+) const -> std::uint64_t
+{
+    return tradeCount_;
+}
+
+
+//=============================================================================
+template <lime::fixed_price_concept P, lime::chrono_duration_concept D>
+inline void lime::trade_statistics<P, D>::clear
+(
+)
+{
+    *this = trade_statistics();
+}
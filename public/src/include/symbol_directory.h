@@ -0,0 +1,242 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./non_copyable.h"
+#include "./non_movable.h"
+#include "./cache_line.h"
+#include "./symbol_name.h"
+#include "./type_rich.h"
+#include "./bit.h"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+
+namespace lime
+{
+
+    using symbol_id = type_rich<struct symbol_id_tag, std::uint32_t>;
+
+
+    //=========================================================================
+    // interns symbol names into dense ids [0, size()) so that later stages can index flat
+    // arrays by id rather than hashing names.  lookups go through an open addressing table
+    // (linear probing) keyed on the hash of the packed symbol bytes.  each slot is a single
+    // atomic word holding the upper 32 bits of the hash and the id + 1 (zero is empty) so
+    // most mismatches are rejected without touching the symbol storage.
+    //
+    // a single writer may insert while any number of readers call find() and get_symbol().
+    // the symbol is written before its slot is published with release semantics so a reader
+    // which acquires a slot always sees the complete symbol.  entries are never removed and
+    // storage is allocated up front so nothing readers hold is ever moved.
+    template <symbol_name_concept S, type_rich_concept I = symbol_id>
+    requires std::unsigned_integral<typename I::value_type>
+    class symbol_directory :
+        non_copyable,
+        non_movable
+    {
+    public:
+
+        using symbol_type = S;
+        using id_type = I;
+
+        explicit symbol_directory
+        (
+            std::size_t
+        );
+
+        ~symbol_directory() = default;
+
+        std::optional<id_type> find
+        (
+            symbol_type const &
+        ) const;
+
+        // writer only.  returns the existing id if the symbol is already interned
+        // or nullopt if the directory is full.
+        std::optional<id_type> insert
+        (
+            symbol_type const &
+        );
+
+        symbol_type const & get_symbol
+        (
+            id_type
+        ) const;
+
+        std::size_t size() const;
+
+        std::size_t capacity() const;
+
+    private:
+
+        static auto constexpr empty_slot = std::uint64_t(0);
+        static auto constexpr id_mask = std::uint64_t(0xffffffff);
+
+        static std::uint64_t get_slot_tag
+        (
+            std::uint64_t
+        );
+
+        std::uint64_t const                         capacity_;
+
+        std::uint64_t const                         slotMask_;
+
+        std::unique_ptr<std::atomic<std::uint64_t>[]> slots_;
+
+        std::vector<symbol_type>                    symbols_;
+
+        alignas(cache_line_size) std::atomic<std::size_t> size_{0};
+    };
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+lime::symbol_directory<S, I>::symbol_directory
+(
+    // the slot table is kept at most half full.  slots are value initialized (empty).
+    std::size_t capacity
+):
+    capacity_(std::min<std::uint64_t>(capacity, std::min<std::uint64_t>(id_mask - 1, std::numeric_limits<typename I::value_type>::max()))),
+    slotMask_(minimum_power_of_two(std::max<std::uint64_t>(capacity_ * 2, 2)) - 1),
+    slots_(std::make_unique<std::atomic<std::uint64_t>[]>(slotMask_ + 1)),
+    symbols_(capacity_)
+{
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::symbol_directory<S, I>::get_slot_tag
+(
+    std::uint64_t hash
+) -> std::uint64_t
+{
+    return ((hash >> 32) << 32);
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::symbol_directory<S, I>::find
+(
+    symbol_type const & symbol
+) const -> std::optional<id_type>
+{
+    auto hash = symbol.hash();
+    auto tag = get_slot_tag(hash);
+    for (auto index = (hash & slotMask_); ; index = ((index + 1) & slotMask_))
+    {
+        auto slot = slots_[index].load(std::memory_order_acquire);
+        if (slot == empty_slot)
+            return std::nullopt;
+        if (((slot & ~id_mask) == tag) && (symbols_[(slot & id_mask) - 1] == symbol))
+            return id_type((slot & id_mask) - 1);
+    }
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::symbol_directory<S, I>::insert
+(
+    symbol_type const & symbol
+) -> std::optional<id_type>
+{
+    auto hash = symbol.hash();
+    auto tag = get_slot_tag(hash);
+    auto index = (hash & slotMask_);
+    for (; ; index = ((index + 1) & slotMask_))
+    {
+        // the writer is the only thread which stores slots so relaxed loads are sufficient here
+        auto slot = slots_[index].load(std::memory_order_relaxed);
+        if (slot == empty_slot)
+            break;
+        if (((slot & ~id_mask) == tag) && (symbols_[(slot & id_mask) - 1] == symbol))
+            return id_type((slot & id_mask) - 1);
+    }
+
+    auto id = size_.load(std::memory_order_relaxed);
+    if (id >= capacity_)
+        return std::nullopt;
+    symbols_[id] = symbol;
+    slots_[index].store(tag | (id + 1), std::memory_order_release);
+    size_.store(id + 1, std::memory_order_release);
+    return id_type(id);
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::symbol_directory<S, I>::get_symbol
+(
+    // id must have been obtained from find() or insert()
+    id_type id
+) const -> symbol_type const &
+{
+    return symbols_[id.get()];
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::symbol_directory<S, I>::size
+(
+) const -> std::size_t
+{
+    return size_.load(std::memory_order_acquire);
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::type_rich_concept I>
+requires std::unsigned_integral<typename I::value_type>
+inline auto lime::symbol_directory<S, I>::capacity
+(
+) const -> std::size_t
+{
+    return capacity_;
+}
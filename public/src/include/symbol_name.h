@@ -32,13 +32,22 @@ SOFTWARE.
 #include <include/endian.h>
 
 #include <array>
+#include <bit>
+#include <compare>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
 #include <string_view>
 #include <type_traits>
 #include <concepts>
 #include <span>
 #include <algorithm>
 
+#if defined(__SSE2__)
+    #include <immintrin.h>
+#endif
+
 
 namespace lime
 {
@@ -54,27 +63,27 @@ namespace lime
         using value_type = std::array<char, max_size>;
         using size_type = std::size_t;
 
-        symbol_name();
+        constexpr symbol_name();
 
-        symbol_name(symbol_name const &) = default;
-        symbol_name & operator = (symbol_name const &) = default;
+        constexpr symbol_name(symbol_name const &) = default;
+        constexpr symbol_name & operator = (symbol_name const &) = default;
 
-        symbol_name
+        constexpr symbol_name
         (
             value_type const &
         );
 
-        symbol_name
+        constexpr symbol_name
         (
             std::string const &
         );
 
-        symbol_name
+        constexpr symbol_name
         (
             std::string_view const
         );
 
-        symbol_name
+        constexpr symbol_name
         (
             std::span<char const>
         );
@@ -85,7 +94,7 @@ namespace lime
 
         constexpr operator std::span<char const> const() const;
 
-        constexpr size_type size();
+        constexpr size_type size() const;
 
         static constexpr size_type capacity();
 
@@ -93,6 +102,8 @@ namespace lime
 
         constexpr auto empty() const;
 
+        constexpr auto data() const{return value_.data();}
+
         constexpr auto begin() const{return value_.begin();}
 
         constexpr auto end() const{return value_.end();}
@@ -101,16 +112,32 @@ namespace lime
 
         constexpr auto end(){return value_.end();}
 
-        constexpr auto operator <=>
+        constexpr std::uint64_t hash
         (
-            symbol_name const & other
-        ) const
-        {
-            return strncmp(value_.data(), other.value_.data(), value_.size());
-        }
-        
+            std::uint64_t = 0
+        ) const;
+
+        constexpr std::strong_ordering operator <=>
+        (
+            symbol_name const &
+        ) const;
+
+        constexpr bool operator ==
+        (
+            symbol_name const &
+        ) const;
+
     private:
 
+        static auto constexpr word_size = sizeof(std::uint64_t);
+        static auto constexpr word_count = ((max_size + word_size - 1) / word_size);
+
+        // the 'index'th 8 byte word of the symbol in memory order.  a final partial word is zero padded.
+        constexpr std::uint64_t get_word
+        (
+            std::size_t
+        ) const;
+
         value_type  value_;
 
     }; // symbol
@@ -137,59 +164,66 @@ namespace lime
 
 //=============================================================================
 template <std::size_t N, char F>
-lime::symbol_name<N, F>::symbol_name
+struct std::hash<lime::symbol_name<N, F>>
+{
+    constexpr std::size_t operator()
+    (
+        lime::symbol_name<N, F> const & symbolName
+    ) const noexcept
+    {
+        return symbolName.hash();
+    }
+};
+
+
+//=============================================================================
+template <std::size_t N, char F>
+constexpr lime::symbol_name<N, F>::symbol_name
 (
 )
 {
-    std::fill_n(value_.data(), fill, value_.size());
+    std::fill_n(value_.data(), value_.size(), fill);
 }
 
 
 //=============================================================================
 template <std::size_t N, char F>
-lime::symbol_name<N, F>::symbol_name
+constexpr lime::symbol_name<N, F>::symbol_name
 (
     std::string_view const value
 )
 {
     auto bytesToCopy = std::min(value.size(), value_.size());
-    std::copy_n(value_.data(), bytesToCopy, value.data());
-    if (bytesToCopy < value_.size())
-        std::fill_n(value_.data() + bytesToCopy, fill, value_.size() - bytesToCopy);
+    std::copy_n(value.data(), bytesToCopy, value_.data());
+    std::fill_n(value_.data() + bytesToCopy, value_.size() - bytesToCopy, fill);
 }
 
 
 //=============================================================================
 template <std::size_t N, char F>
-lime::symbol_name<N, F>::symbol_name
+constexpr lime::symbol_name<N, F>::symbol_name
 (
     std::string const & value
-)
+):
+    symbol_name(std::string_view(value))
 {
-    auto bytesToCopy = std::min(value.size(), value_.size());
-    std::copy_n(value_.data(), bytesToCopy, value.data());
-    if (bytesToCopy < value_.size())
-        std::fill_n(value_.data() + bytesToCopy, fill, value_.size() - bytesToCopy);
 }
 
 
 //=============================================================================
 template <std::size_t N, char F>
-lime::symbol_name<N, F>::symbol_name
+constexpr lime::symbol_name<N, F>::symbol_name
 (
     std::span<char const> value
-)
+):
+    symbol_name(std::string_view(value.data(), value.size()))
 {
-    auto bytesToCopy = std::min(value.size(), value_.size());
-    std::copy_n(value_.data(), bytesToCopy, value.data());
-    if (bytesToCopy < value_.size())
-        std::fill_n(value_.data() + bytesToCopy, fill, value_.size() - bytesToCopy);
 }
 
 
 //=============================================================================
 template <std::size_t N, char F>
-lime::symbol_name<N, F>::symbol_name
+constexpr lime::symbol_name<N, F>::symbol_name
 (
     value_type const & value
 ):
@@ -228,16 +262,79 @@ constexpr lime::symbol_name<N, F>::operator std::span<char const> const
 }
 
 
+//=============================================================================
+template <std::size_t N, char F>
+constexpr std::uint64_t lime::symbol_name<N, F>::get_word
+(
+    std::size_t index
+) const
+{
+    auto offset = (index * word_size);
+    auto bytes = std::min(word_size, max_size - offset);
+    std::uint64_t word = 0;
+    if (std::is_constant_evaluated())
+    {
+        for (auto i = 0ull; i < bytes; ++i)
+            word |= (std::uint64_t(static_cast<unsigned char>(value_[offset + i])) << (i * 8));
+        if constexpr (std::endian::native == std::endian::big)
+            word = byte_swap(word);
+    }
+    else
+    {
+        std::memcpy(&word, value_.data() + offset, bytes);
+    }
+    return word;
+}
+
+
 //=============================================================================
 template <std::size_t N, char F>
 auto constexpr lime::symbol_name<N, F>::size
 (
-) -> size_type
+    // the position of the first fill character (or capacity if there is none).
+    // compares a vector (or word) of characters against the fill at a time.
+) const -> size_type
 {
-    for (auto i = 0; i < capacity(); ++i)
-        if (value_[i] == fill)
-            return i;
-    return capacity;
+    static_assert(std::endian::native == std::endian::little, "word scan assumes little endian");
+
+    if (std::is_constant_evaluated())
+    {
+        for (auto i = 0ull; i < capacity(); ++i)
+            if (value_[i] == fill)
+                return i;
+        return capacity();
+    }
+
+    std::size_t offset = 0;
+    #if defined(__AVX2__)
+        for (; (offset + 32) <= max_size; offset += 32)
+        {
+            auto chunk = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(value_.data() + offset));
+            if (auto mask = static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(fill)))); mask != 0)
+                return (offset + std::countr_zero(mask));
+        }
+    #endif
+    #if defined(__SSE2__)
+        for (; (offset + 16) <= max_size; offset += 16)
+        {
+            auto chunk = _mm_loadu_si128(reinterpret_cast<__m128i const *>(value_.data() + offset));
+            if (auto mask = static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8(fill)))); mask != 0)
+                return (offset + std::countr_zero(mask));
+        }
+    #endif
+
+    // remaining bytes a word at a time.  xor with the fill turns fill bytes into zero bytes
+    // and the classic has-zero-byte expression marks them.  the lowest marked byte is exact.
+    auto constexpr low_bits = 0x0101010101010101ull;
+    auto constexpr high_bits = 0x8080808080808080ull;
+    auto constexpr fill_bits = (low_bits * static_cast<unsigned char>(fill));
+    for (; offset < max_size; offset += word_size)
+    {
+        auto word = (get_word(offset / word_size) ^ fill_bits);
+        if (auto mask = ((word - low_bits) & ~word & high_bits); mask != 0)
+            return std::min<size_type>(offset + (std::countr_zero(mask) / 8), max_size);
+    }
+    return max_size;
 }
 
 
@@ -247,7 +344,7 @@ auto constexpr lime::symbol_name<N, F>::empty
 (
 ) const
 {
-    return (size() == 0);
+    return (value_[0] == fill);
 }
 
 
@@ -269,3 +366,55 @@ auto constexpr lime::symbol_name<N, F>::get_fill_character
 {
     return fill;
 }
+
+
+//=============================================================================
+template <std::size_t N, char F>
+constexpr bool lime::symbol_name<N, F>::operator ==
+(
+    symbol_name const & other
+) const
+{
+    std::uint64_t difference = 0;
+    for (auto i = 0ull; i < word_count; ++i)
+        difference |= (get_word(i) ^ other.get_word(i));
+    return (difference == 0);
+}
+
+
+//=============================================================================
+template <std::size_t N, char F>
+constexpr std::strong_ordering lime::symbol_name<N, F>::operator <=>
+(
+    // lexicographic (unsigned) byte order, as strncmp over the full capacity.  the first
+    // differing word decides and byte swapping it makes the integer compare lexicographic.
+    symbol_name const & other
+) const
+{
+    for (auto i = 0ull; i < word_count; ++i)
+        if (auto a = get_word(i), b = other.get_word(i); a != b)
+            return (byte_swap(a) <=> byte_swap(b));
+    return std::strong_ordering::equal;
+}
+
+
+//=============================================================================
+template <std::size_t N, char F>
+constexpr std::uint64_t lime::symbol_name<N, F>::hash
+(
+    // hash of the packed bytes a word at a time (multiply/xor-shift mixing)
+    std::uint64_t seed
+) const
+{
+    auto constexpr multiplier = 0x9e3779b97f4a7c15ull;
+    auto h = (seed ^ (max_size * multiplier));
+    for (auto i = 0ull; i < word_count; ++i)
+    {
+        h = ((h ^ get_word(i)) * multiplier);
+        h ^= (h >> 29);
+    }
+    h ^= (h >> 32);
+    h *= 0xd6e8feb86659fd93ull;
+    h ^= (h >> 32);
+    return h;
+}
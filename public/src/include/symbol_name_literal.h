@@ -0,0 +1,181 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./symbol_name.h"
+#include "./constexpr_string.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    template <symbol_name_concept S, constexpr_string V>
+    requires ((std::string_view(V).size() > 0) && (std::string_view(V).size() <= S::capacity()))
+    inline constexpr S symbol_name_constant = S(std::string_view(V));
+
+
+    //=========================================================================
+    // a symbol known at compile time.  converts to any symbol_name large enough to hold it.
+    // use symbol_name_constant<S, V> (or compare against the literal) to have the padded
+    // symbol built by the compiler rather than on the hot path.
+    template <constexpr_string V>
+    struct symbol_name_literal
+    {
+        static auto constexpr value = V;
+
+        static constexpr std::size_t size(){return std::string_view(value).size();}
+
+        template <std::size_t N, char F>
+        requires (size() <= N)
+        constexpr operator symbol_name<N, F>() const{return symbol_name_constant<symbol_name<N, F>, V>;}
+    };
+
+
+    //=========================================================================
+    // a fixed set of symbols, sorted and padded at compile time.  small sets are matched
+    // with a linear scan of word compares and larger ones with a binary search.
+    template <symbol_name_concept S, constexpr_string ... Vs>
+    requires (sizeof...(Vs) > 0)
+    class constexpr_symbol_set
+    {
+    public:
+
+        using symbol_type = S;
+
+        static constexpr std::size_t size(){return sizeof...(Vs);}
+
+        static constexpr bool contains
+        (
+            symbol_type const &
+        );
+
+        // index of the symbol in sorted order
+        static constexpr std::optional<std::size_t> find
+        (
+            symbol_type const &
+        );
+
+        static constexpr auto const & get_symbols(){return symbols;}
+
+    private:
+
+        static auto constexpr linear_search_limit = std::size_t(8);
+
+        static constexpr std::array<symbol_type, sizeof...(Vs)> get_sorted_symbols();
+
+        static auto constexpr symbols = get_sorted_symbols();
+    };
+
+
+    namespace literals
+    {
+        //=====================================================================
+        template <constexpr_string V>
+        constexpr auto operator ""_symbol
+        (
+        )
+        {
+            return symbol_name_literal<V>{};
+        }
+
+    } // namespace literals
+
+} // namespace lime
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::constexpr_string ... Vs>
+requires (sizeof...(Vs) > 0)
+constexpr auto lime::constexpr_symbol_set<S, Vs ...>::get_sorted_symbols
+(
+) -> std::array<symbol_type, sizeof...(Vs)>
+{
+    std::array<symbol_type, sizeof...(Vs)> sorted{symbol_name_constant<symbol_type, Vs> ...};
+    std::sort(sorted.begin(), sorted.end());
+    if (std::adjacent_find(sorted.begin(), sorted.end()) != sorted.end())
+        throw "constexpr_symbol_set: duplicate symbol"; // not a constant expression, fails compilation
+    return sorted;
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::constexpr_string ... Vs>
+requires (sizeof...(Vs) > 0)
+constexpr auto lime::constexpr_symbol_set<S, Vs ...>::find
+(
+    symbol_type const & symbol
+) -> std::optional<std::size_t>
+{
+    if constexpr (size() <= linear_search_limit)
+    {
+        for (auto i = 0ull; i < size(); ++i)
+            if (symbols[i] == symbol)
+                return i;
+        return std::nullopt;
+    }
+    else
+    {
+        auto iter = std::lower_bound(symbols.begin(), symbols.end(), symbol);
+        if ((iter == symbols.end()) || (*iter != symbol))
+            return std::nullopt;
+        return std::distance(symbols.begin(), iter);
+    }
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::constexpr_string ... Vs>
+requires (sizeof...(Vs) > 0)
+constexpr auto lime::constexpr_symbol_set<S, Vs ...>::contains
+(
+    symbol_type const & symbol
+) -> bool
+{
+    return find(symbol).has_value();
+}
+
+
+//=============================================================================
+template <lime::symbol_name_concept S, lime::constexpr_string V>
+static constexpr auto operator ==
+(
+    S const & first,
+    lime::symbol_name_literal<V>
+) -> bool
+{
+    return (first == lime::symbol_name_constant<S, V>);
+}
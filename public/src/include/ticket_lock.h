@@ -0,0 +1,111 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/non_copyable.h>
+#include <include/cache_line.h>
+#include <include/cpu_pause.h>
+
+#include <atomic>
+#include <cstdint>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // fifo spin lock.  each thread takes a ticket and waits until it is served so the
+    // wait of any thread is bounded by the number of threads ahead of it.  waiters back
+    // off in proportion to their distance from the head of the line.
+    class ticket_lock final :
+        non_copyable
+    {
+    public:
+
+        static auto constexpr backoff_per_waiter = 8u;
+
+        ticket_lock() = default;
+        ~ticket_lock() = default;
+
+        void lock();
+
+        void unlock();
+
+        bool try_lock();
+
+    private:
+
+        // arrivals increment next_ while waiters poll serving_ so keep them on separate lines
+        alignas(cache_line_size) std::atomic<std::uint32_t> next_{0};
+        alignas(cache_line_size) std::atomic<std::uint32_t> serving_{0};
+
+    }; // class ticket_lock
+
+} // namespace lime
+
+
+//=============================================================================
+inline void lime::ticket_lock::lock
+(
+)
+{
+    auto ticket = next_.fetch_add(1, std::memory_order_relaxed);
+    while (true)
+    {
+        auto serving = serving_.load(std::memory_order_acquire);
+        if (serving == ticket)
+            return;
+        for (auto i = 0u, n = ((ticket - serving) * backoff_per_waiter); i < n; ++i)
+            cpu_pause();
+    }
+}
+
+
+//=============================================================================
+inline void lime::ticket_lock::unlock
+(
+)
+{
+    serving_.store(serving_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+
+//=============================================================================
+inline bool lime::ticket_lock::try_lock
+(
+)
+{
+    // the lock is free only when the next ticket is the one being served.  next_ is only
+    // ever written relaxed so it is the acquire of serving_ (not the cas) which pairs with
+    // the release in unlock and orders this critical section after the previous one.
+    auto serving = serving_.load(std::memory_order_acquire);
+    auto expected = serving;
+    return next_.compare_exchange_strong(expected, serving + 1, std::memory_order_acquire, std::memory_order_relaxed);
+}
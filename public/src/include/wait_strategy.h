@@ -0,0 +1,223 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include "./cpu_pause.h"
+#include "./futex.h"
+#include "./cache_line.h"
+#include "./synchronization_mode.h"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+
+namespace lime
+{
+
+    //=========================================================================
+    // wait strategies decide how a consumer waits for a condition to become true
+    // (wait) and what a producer must do after making it true (notify).
+    template <typename T>
+    concept wait_strategy_concept = requires (T t, bool (*predicate)())
+    {
+        t.wait(predicate);
+        t.notify();
+    };
+
+
+    //=========================================================================
+    // spin on the condition with cpu_pause.  lowest latency.  owns the core.
+    class busy_spin_wait_strategy
+    {
+    public:
+
+        void wait
+        (
+            std::predicate auto predicate
+        )
+        {
+            while (not predicate())
+                cpu_pause();
+        }
+
+        void notify(){}
+
+    }; // class busy_spin_wait_strategy
+
+
+    //=========================================================================
+    // spin for a bounded number of iterations then yield the cpu between checks.
+    // the consumer remains runnable but gives way to other threads on a shared core.
+    template <std::size_t N = 4096>
+    class spin_then_yield_wait_strategy
+    {
+    public:
+
+        static auto constexpr spin_count = N;
+
+        void wait
+        (
+            std::predicate auto predicate
+        )
+        {
+            for (auto i = 0ull; i < spin_count; ++i)
+            {
+                if (predicate())
+                    return;
+                cpu_pause();
+            }
+            while (not predicate())
+                std::this_thread::yield();
+        }
+
+        void notify(){}
+
+    }; // class spin_then_yield_wait_strategy
+
+
+    //=========================================================================
+    // spin briefly then sleep on a futex.  the producer only issues the wake syscall
+    // when a consumer has registered itself as waiting so the uncontended notify is
+    // a fence and a load.
+    template <std::size_t N = 1024>
+    class futex_wait_strategy
+    {
+    public:
+
+        static auto constexpr spin_count = N;
+
+        futex_wait_strategy() = default;
+        futex_wait_strategy(futex_wait_strategy &&);
+        futex_wait_strategy & operator = (futex_wait_strategy &&);
+
+        void wait
+        (
+            std::predicate auto
+        );
+
+        void notify();
+
+    private:
+
+        alignas(cache_line_size) std::atomic<std::uint32_t> sequence_{0};
+        std::atomic<std::uint32_t>                          waiters_{0};
+
+    }; // class futex_wait_strategy
+
+
+    //=========================================================================
+    // synchronous waits keep the thread on its cpu (isolated cores).  asynchronous
+    // waits hand the cpu back to the scheduler until there is work (shared cores).
+    template <synchronization_mode> struct synchronization_mode_wait_strategy;
+
+    template <> struct synchronization_mode_wait_strategy<synchronization_mode::synchronous>{using type = busy_spin_wait_strategy;};
+    template <> struct synchronization_mode_wait_strategy<synchronization_mode::asynchronous>{using type = futex_wait_strategy<>;};
+
+    template <synchronization_mode M> using wait_strategy = typename synchronization_mode_wait_strategy<M>::type;
+
+} // namespace lime
+
+
+//=============================================================================
+template <std::size_t N>
+lime::futex_wait_strategy<N>::futex_wait_strategy
+(
+    // waiters can not be moved with the strategy.  moving is only
+    // meaningful while no thread is waiting.
+    futex_wait_strategy &&
+)
+{
+}
+
+
+//=============================================================================
+template <std::size_t N>
+auto lime::futex_wait_strategy<N>::operator =
+(
+    futex_wait_strategy &&
+) -> futex_wait_strategy &
+{
+    return *this;
+}
+
+
+//=============================================================================
+template <std::size_t N>
+void lime::futex_wait_strategy<N>::wait
+(
+    std::predicate auto predicate
+)
+{
+    for (auto i = 0ull; i < spin_count; ++i)
+    {
+        if (predicate())
+            return;
+        cpu_pause();
+    }
+
+    while (true)
+    {
+        // register before the final check of the condition.  the fence after the increment
+        // pairs with the fence in notify() so that either this thread observes the condition
+        // or the producer observes the waiter (and changes sequence_ before waking).  the
+        // fence (rather than the increment alone) keeps the predicate's loads from being
+        // satisfied before the registration is visible.
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto sequence = sequence_.load(std::memory_order_acquire);
+        if (predicate())
+        {
+            waiters_.fetch_sub(1, std::memory_order_relaxed);
+            return;
+        }
+        futex_wait(sequence_, sequence);
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        if (predicate())
+            return;
+    }
+}
+
+
+//=============================================================================
+template <std::size_t N>
+inline void lime::futex_wait_strategy<N>::notify
+(
+)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) != 0)
+    {
+        sequence_.fetch_add(1, std::memory_order_release);
+        futex_wake(sequence_);
+    }
+}
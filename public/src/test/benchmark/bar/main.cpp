@@ -0,0 +1,321 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+// replays a synthetic trade tape across many symbols into bar_builder and into a reference
+// which accumulates each interval's bars in a std::unordered_map keyed by symbol id and
+// writes them out as columns when the interval completes.  symbol activity is skewed (zipf)
+// as it is on a real tape and trades arrive at a constant rate.
+//
+//  bar_benchmark [--trades 10000000] [--repetitions 3] [--symbols 10000]
+//                [--interval_ms 1000] [--trades_per_second 2000000]
+
+#include <test/benchmark/benchmark.h>
+#include <include/statistics.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace
+{
+
+    using namespace lime::benchmark;
+
+    using price_type = lime::fixed_price<4>;
+    using shares_type = lime::shares<std::uint64_t>;
+    using time_type = lime::nanoseconds_since_midnight;
+
+
+    //=========================================================================
+    struct configuration
+    {
+        std::size_t     tradeCount_;
+        std::uint64_t   repetitions_;
+        std::size_t     symbolCount_;
+        std::uint64_t   intervalInNanoseconds_;
+        std::uint64_t   tradesPerSecond_;
+    };
+
+
+    //=========================================================================
+    struct trade
+    {
+        std::uint32_t   symbol_;
+        std::uint32_t   shares_;
+        std::uint64_t   price_;
+        std::int64_t    time_;
+    };
+
+
+    //=========================================================================
+    std::vector<trade> make_trades
+    (
+        configuration const & configuration
+    )
+    {
+        // symbol i trades with weight 1 / (i + 1)
+        std::mt19937_64 generator(17);
+        std::vector<double> weights(configuration.symbolCount_);
+        for (auto i = 0ull; i < weights.size(); ++i)
+            weights[i] = 1.0 / (i + 1);
+        std::discrete_distribution<std::uint32_t> symbols(weights.begin(), weights.end());
+        std::vector<std::uint64_t> prices(configuration.symbolCount_);
+        for (auto & price : prices)
+            price = 10000 * (1 + (generator() % 500));
+
+        std::vector<trade> trades;
+        trades.reserve(configuration.tradeCount_);
+        auto time = std::int64_t(9.5 * 3600) * 1000000000;
+        auto spacing = (1e9 / configuration.tradesPerSecond_);
+        for (auto i = 0ull; i < configuration.tradeCount_; ++i)
+        {
+            auto symbol = symbols(generator);
+            auto & price = prices[symbol];
+            price = std::max<std::uint64_t>(price + (generator() % 201) - 100, 100);
+            trades.push_back({symbol, std::uint32_t(100 * (1 + (generator() % 5))), price, time + std::int64_t(i * spacing)});
+        }
+        return trades;
+    }
+
+
+    //=========================================================================
+    // a bar per symbol in a hash map, written out as columns when the interval completes
+    class reference
+    {
+    public:
+
+        reference
+        (
+            configuration const & configuration
+        ):
+            interval_(configuration.intervalInNanoseconds_),
+            columns_(configuration.symbolCount_),
+            previousClose_(configuration.symbolCount_)
+        {
+        }
+
+        bool update
+        (
+            trade const & trade
+        )
+        {
+            auto completed = false;
+            auto start = ((trade.time_ / interval_) * interval_);
+            if (start != intervalStart_)
+            {
+                completed = !bars_.empty();
+                if (completed)
+                    complete();
+                intervalStart_ = start;
+            }
+            auto [iter, inserted] = bars_.try_emplace(trade.symbol_, bar{trade.price_, trade.price_, trade.price_, trade.price_, 0, 0, 0});
+            auto & bar = iter->second;
+            bar.high_ = std::max(bar.high_, trade.price_);
+            bar.low_ = std::min(bar.low_, trade.price_);
+            bar.close_ = trade.price_;
+            bar.volume_ += trade.shares_;
+            bar.notional_ += static_cast<unsigned __int128>(trade.price_) * trade.shares_;
+            ++bar.tradeCount_;
+            return completed;
+        }
+
+        bool flush()
+        {
+            auto completed = !bars_.empty();
+            if (completed)
+                complete();
+            return completed;
+        }
+
+        lime::bar_columns<price_type, std::chrono::nanoseconds> const & get_bars() const{return columns_;}
+
+    private:
+
+        struct bar
+        {
+            std::uint64_t       open_;
+            std::uint64_t       high_;
+            std::uint64_t       low_;
+            std::uint64_t       close_;
+            std::uint64_t       volume_;
+            unsigned __int128   notional_;
+            std::uint32_t       tradeCount_;
+        };
+
+        void complete()
+        {
+            for (auto i = 0ull; i < previousClose_.size(); ++i)
+            {
+                columns_.open_[i] = columns_.high_[i] = columns_.low_[i] = columns_.close_[i] = previousClose_[i];
+                columns_.vwap_[i] = columns_.volume_[i] = columns_.tradeCount_[i] = 0;
+            }
+            for (auto const & [symbol, bar] : bars_)
+            {
+                columns_.open_[symbol] = bar.open_;
+                columns_.high_[symbol] = bar.high_;
+                columns_.low_[symbol] = bar.low_;
+                columns_.close_[symbol] = previousClose_[symbol] = bar.close_;
+                columns_.vwap_[symbol] = std::uint64_t((bar.notional_ + (bar.volume_ / 2)) / bar.volume_);
+                columns_.volume_[symbol] = bar.volume_;
+                columns_.tradeCount_[symbol] = bar.tradeCount_;
+            }
+            bars_.clear();
+        }
+
+        std::int64_t                                    interval_;
+
+        std::int64_t                                    intervalStart_{-1};
+
+        std::unordered_map<std::uint32_t, bar>          bars_;
+
+        lime::bar_columns<price_type, std::chrono::nanoseconds> columns_;
+
+        std::vector<std::uint64_t>                      previousClose_;
+    };
+
+
+    //=========================================================================
+    struct lime_bars
+    {
+        lime_bars(configuration const & configuration):
+            builder_(std::chrono::nanoseconds(configuration.intervalInNanoseconds_), configuration.symbolCount_){}
+
+        bool update(trade const & trade)
+        {
+            return builder_.update(lime::symbol_id(trade.symbol_), price_type(lime::price<>(trade.price_, price_type::precision)),
+                    shares_type(trade.shares_), time_type(std::chrono::nanoseconds(trade.time_)));
+        }
+
+        bool flush(){return builder_.flush();}
+
+        auto const & get_bars() const{return builder_.get_bars();}
+
+        lime::bar_builder<price_type> builder_;
+    };
+
+
+    //=========================================================================
+    template <typename B>
+    std::pair<double, std::uint64_t> replay
+    (
+        // best of the repetitions in nanoseconds per trade and a checksum of every bar
+        configuration const & configuration,
+        std::vector<trade> const & trades
+    )
+    {
+        auto best = ~std::uint64_t(0);
+        std::uint64_t checksum = 0;
+        for (auto repetition = 0ull; repetition < configuration.repetitions_; ++repetition)
+        {
+            B bars(configuration);
+            std::uint64_t sum = 0;
+            auto add = [&]()
+                    {
+                        auto const & columns = bars.get_bars();
+                        for (auto i = 0ull; i < configuration.symbolCount_; ++i)
+                            sum += (columns.open_[i] ^ columns.high_[i] ^ columns.low_[i] ^ columns.close_[i] ^ columns.vwap_[i]) + columns.volume_[i] + columns.tradeCount_[i];
+                    };
+            auto elapsed = std::uint64_t(0);
+            auto start = now_in_nanoseconds();
+            for (auto const & trade : trades)
+            {
+                if (bars.update(trade))
+                {
+                    // the consumer's read of the columns is not timed
+                    elapsed += (now_in_nanoseconds() - start);
+                    add();
+                    start = now_in_nanoseconds();
+                }
+            }
+            if (bars.flush())
+                add();
+            elapsed += (now_in_nanoseconds() - start);
+            best = std::min(best, elapsed);
+            checksum = sum;
+        }
+        return {double(best) / trades.size(), checksum};
+    }
+
+
+    //=========================================================================
+    void report
+    (
+        std::string const & implementation,
+        configuration const & configuration,
+        double nanosecondsPerTrade,
+        bool correct
+    )
+    {
+        json_line()
+                .add("benchmark", "bar")
+                .add("test", "replay")
+                .add("implementation", implementation)
+                .add("trades", configuration.tradeCount_)
+                .add("symbols", configuration.symbolCount_)
+                .add("interval_ns", configuration.intervalInNanoseconds_)
+                .add("trades_per_second", configuration.tradesPerSecond_)
+                .add("correct", correct ? 1 : 0)
+                .add("ns_per_trade", nanosecondsPerTrade)
+                .add("million_per_second", 1e3 / std::max(nanosecondsPerTrade, 1e-9))
+                .print();
+    }
+
+} // namespace
+
+
+//=============================================================================
+int main
+(
+    int argc,
+    char ** argv
+)
+{
+    arguments args(argc, argv);
+    configuration configuration{};
+    configuration.tradeCount_ = args.get("--trades", std::uint64_t(10000000));
+    configuration.repetitions_ = std::max<std::uint64_t>(args.get("--repetitions", std::uint64_t(3)), 1);
+    configuration.symbolCount_ = args.get("--symbols", std::uint64_t(10000));
+    configuration.intervalInNanoseconds_ = args.get("--interval_ms", std::uint64_t(1000)) * 1000000;
+    configuration.tradesPerSecond_ = args.get("--trades_per_second", std::uint64_t(2000000));
+    if ((configuration.tradeCount_ == 0) || (configuration.symbolCount_ == 0) || (configuration.intervalInNanoseconds_ == 0) || (configuration.tradesPerSecond_ == 0))
+        return 1;
+
+    auto trades = make_trades(configuration);
+    auto [referenceTime, referenceChecksum] = replay<reference>(configuration, trades);
+    auto [time, checksum] = replay<lime_bars>(configuration, trades);
+    report("unordered_map", configuration, referenceTime, true);
+    report("bar_builder", configuration, time, (checksum == referenceChecksum));
+    return 0;
+}
@@ -0,0 +1,419 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+#pragma once
+
+#include <include/cpu_pause.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <pthread.h>
+#include <sched.h>
+
+
+// helpers shared by the benchmark executables.  results are written as one json
+// object per line so that runs can be collected and compared across releases.
+namespace lime::benchmark
+{
+
+    //=========================================================================
+    struct cpu_info
+    {
+        int cpu_;
+        int core_;
+        int package_;
+        int node_;
+    };
+
+
+    enum class core_topology : std::uint32_t
+    {
+        unpinned        = 0,    // no affinity.  the scheduler decides
+        same_core       = 1,    // hyperthread siblings of one physical core
+        same_socket     = 2,    // different physical cores of one package
+        cross_numa      = 3     // cores on different numa nodes
+    };
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static std::string_view to_string
+    (
+        core_topology coreTopology
+    )
+    {
+        switch (coreTopology)
+        {
+            case core_topology::unpinned: return "unpinned";
+            case core_topology::same_core: return "same_core";
+            case core_topology::same_socket: return "same_socket";
+            case core_topology::cross_numa: return "cross_numa";
+        }
+        return "unknown";
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static std::optional<core_topology> to_core_topology
+    (
+        std::string_view name
+    )
+    {
+        for (auto coreTopology : {core_topology::unpinned, core_topology::same_core, core_topology::same_socket, core_topology::cross_numa})
+            if (to_string(coreTopology) == name)
+                return coreTopology;
+        return std::nullopt;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static int read_integer_file
+    (
+        std::filesystem::path const & path,
+        int defaultValue
+    )
+    {
+        std::ifstream stream(path);
+        int value = defaultValue;
+        if (stream)
+            stream >> value;
+        return value;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static std::vector<cpu_info> get_cpu_topology
+    (
+        // online cpus as described by sysfs.  cpus for which topology is
+        // not published are reported with core/package/node of -1
+    )
+    {
+        namespace fs = std::filesystem;
+        std::vector<cpu_info> cpus;
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        if (::sched_getaffinity(0, sizeof(cpuSet), &cpuSet) != 0)
+            return cpus;
+        for (auto cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (not CPU_ISSET(cpu, &cpuSet))
+                continue;
+            fs::path base = "/sys/devices/system/cpu/cpu" + std::to_string(cpu);
+            auto node = -1;
+            std::error_code errorCode;
+            for (auto const & entry : fs::directory_iterator(base, errorCode))
+                if (auto name = entry.path().filename().string(); name.starts_with("node"))
+                    node = std::atoi(name.c_str() + 4);
+            cpus.push_back({cpu, read_integer_file(base / "topology/core_id", -1), 
+                    read_integer_file(base / "topology/physical_package_id", -1), node});
+        }
+        return cpus;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static std::optional<std::pair<int, int>> find_cpu_pair
+    (
+        core_topology coreTopology,
+        std::vector<cpu_info> const & cpus
+    )
+    {
+        for (auto const & first : cpus)
+            for (auto const & second : cpus)
+            {
+                if ((first.cpu_ >= second.cpu_) || (first.core_ < 0) || (second.core_ < 0))
+                    continue;
+                auto samePackage = (first.package_ == second.package_);
+                auto sameCore = (samePackage && (first.core_ == second.core_));
+                if (((coreTopology == core_topology::same_core) && (sameCore)) ||
+                    ((coreTopology == core_topology::same_socket) && (samePackage) && (not sameCore)) ||
+                    ((coreTopology == core_topology::cross_numa) && (first.node_ >= 0) && (second.node_ >= 0) && (first.node_ != second.node_)))
+                    return std::make_pair(first.cpu_, second.cpu_);
+            }
+        return std::nullopt;
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static bool pin_to_cpu
+    (
+        // pin the calling thread.  a negative cpu leaves the affinity unchanged
+        int cpu
+    )
+    {
+        if (cpu < 0)
+            return true;
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+        CPU_SET(cpu, &cpuSet);
+        return (::pthread_setaffinity_np(::pthread_self(), sizeof(cpuSet), &cpuSet) == 0);
+    }
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static inline std::uint64_t now_in_nanoseconds
+    (
+    )
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+
+    //=========================================================================
+    // spin until 'predicate' is satisfied.  yields occasionally so that the benchmarks
+    // still make progress when both threads share a cpu.  on dedicated cores the yield is
+    // only reached after the peer has been unresponsive for tens of microseconds.
+    [[__maybe_unused__]]
+    static inline void spin_until
+    (
+        auto && predicate
+    )
+    {
+        for (auto spins = 1u; not predicate(); ++spins)
+        {
+            lime::cpu_pause();
+            if ((spins % 1024) == 0)
+                std::this_thread::yield();
+        }
+    }
+
+
+    //=========================================================================
+    struct latency_statistics
+    {
+        std::uint64_t   samples_{0};
+        double          mean_{0};
+        std::uint64_t   minimum_{0};
+        std::uint64_t   p50_{0};
+        std::uint64_t   p99_{0};
+        std::uint64_t   p99_9_{0};
+        std::uint64_t   maximum_{0};
+    };
+
+
+    //=========================================================================
+    [[__maybe_unused__]]
+    static latency_statistics get_latency_statistics
+    (
+        std::vector<std::uint64_t> samples
+    )
+    {
+        latency_statistics result;
+        if (samples.empty())
+            return result;
+        std::sort(samples.begin(), samples.end());
+        auto percentile = [&](double p)
+                {
+                    auto index = static_cast<std::size_t>(p * samples.size());
+                    return samples[std::min(index, samples.size() - 1)];
+                };
+        double total = 0;
+        for (auto sample : samples)
+            total += sample;
+        result.samples_ = samples.size();
+        result.mean_ = (total / samples.size());
+        result.minimum_ = samples.front();
+        result.p50_ = percentile(0.50);
+        result.p99_ = percentile(0.99);
+        result.p99_9_ = percentile(0.999);
+        result.maximum_ = samples.back();
+        return result;
+    }
+
+
+    //=========================================================================
+    // minimal writer for one flat json object per line
+    class json_line
+    {
+    public:
+
+        json_line & add
+        (
+            std::string_view key,
+            std::string_view value
+        )
+        {
+            separate(key);
+            stream_ << '"' << value << '"';
+            return *this;
+        }
+
+        json_line & add
+        (
+            std::string_view key,
+            char const * value
+        )
+        {
+            return add(key, std::string_view(value));
+        }
+
+        json_line & add
+        (
+            std::string_view key,
+            auto value
+        ) requires (std::is_arithmetic_v<decltype(value)>)
+        {
+            separate(key);
+            stream_ << value;
+            return *this;
+        }
+
+        json_line & add
+        (
+            std::string_view prefix,
+            latency_statistics const & latencyStatistics
+        )
+        {
+            auto key = [&](std::string_view name){return std::string(prefix) + "_" + std::string(name);};
+            add(key("samples"), latencyStatistics.samples_);
+            add(key("mean"), latencyStatistics.mean_);
+            add(key("min"), latencyStatistics.minimum_);
+            add(key("p50"), latencyStatistics.p50_);
+            add(key("p99"), latencyStatistics.p99_);
+            add(key("p99_9"), latencyStatistics.p99_9_);
+            add(key("max"), latencyStatistics.maximum_);
+            return *this;
+        }
+
+        std::string str() const
+        {
+            return stream_.str() + "}";
+        }
+
+        void print
+        (
+            std::FILE * file = stdout
+        ) const
+        {
+            std::fprintf(file, "%s\n", str().c_str());
+            std::fflush(file);
+        }
+
+    private:
+
+        void separate
+        (
+            std::string_view key
+        )
+        {
+            stream_ << (empty_ ? "{" : ",") << '"' << key << "\":";
+            empty_ = false;
+        }
+
+        std::ostringstream  stream_;
+        bool                empty_{true};
+    };
+
+
+    //=========================================================================
+    // command line of the form --name value
+    class arguments
+    {
+    public:
+
+        arguments
+        (
+            int argc,
+            char ** argv
+        ):
+            arguments_(argv + 1, argv + argc)
+        {
+        }
+
+        std::string get
+        (
+            std::string_view name,
+            std::string_view defaultValue
+        ) const
+        {
+            for (auto i = 0ull; (i + 1) < arguments_.size(); ++i)
+                if (arguments_[i] == name)
+                    return arguments_[i + 1];
+            return std::string(defaultValue);
+        }
+
+        std::uint64_t get
+        (
+            std::string_view name,
+            std::uint64_t defaultValue
+        ) const
+        {
+            auto value = get(name, std::string_view());
+            return value.empty() ? defaultValue : std::strtoull(value.c_str(), nullptr, 10);
+        }
+
+        std::vector<std::string> get_list
+        (
+            // comma separated values
+            std::string_view name,
+            std::string_view defaultValue
+        ) const
+        {
+            std::vector<std::string> result;
+            std::stringstream stream(get(name, defaultValue));
+            for (std::string value; std::getline(stream, value, ','); )
+                if (not value.empty())
+                    result.push_back(value);
+            return result;
+        }
+
+        bool has
+        (
+            std::string_view name
+        ) const
+        {
+            return (std::find(arguments_.begin(), arguments_.end(), name) != arguments_.end());
+        }
+
+    private:
+
+        std::vector<std::string> arguments_;
+    };
+
+} // namespace lime::benchmark
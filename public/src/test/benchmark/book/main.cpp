@@ -0,0 +1,604 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+// levels replays a synthetic stream of L2 level updates (adds, partial modifies and deletes)
+// into price_level_book and into a reference book built on std::map, reading the best bid
+// and ask after each update as a feed handler would.  updates cluster near the touch with a
+// geometric distance distribution, the mid price follows a random walk and a small fraction
+// of updates land far from the touch.
+//
+// orders does the same with order by order updates (adds, partial executions or cancels and
+// deletes) into order_book and into a reference built on std::unordered_map and the std::map
+// level book, with the book holding --orders live orders.  the adds which populate the book
+// are not timed.
+//
+//  book_benchmark [--benchmark levels,orders] [--events 2000000] [--repetitions 5]
+//                 [--mix 45,40,15] [--tick 100] [--window 4096] [--depth 8] [--far 1]
+//                 [--orders 1000000]
+
+#include <test/benchmark/benchmark.h>
+#include <include/order_book.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+namespace
+{
+
+    using namespace lime::benchmark;
+
+    using price_type = lime::fixed_price<4>;
+    using shares_type = lime::shares<std::uint64_t>;
+
+
+    //=========================================================================
+    struct configuration
+    {
+        std::size_t     eventCount_;
+        std::uint64_t   repetitions_;
+        std::uint32_t   addPercent_;
+        std::uint32_t   modifyPercent_;
+        std::uint32_t   deletePercent_;
+        std::uint64_t   tickSize_;
+        std::size_t     windowSize_;
+        double          meanDepth_;
+        std::uint32_t   farPercent_;
+        std::size_t     orderCount_;
+    };
+
+
+    //=========================================================================
+    enum class operation : std::uint8_t
+    {
+        add,
+        remove,
+        erase
+    };
+
+
+    //=========================================================================
+    struct event
+    {
+        lime::quotation_type    side_;
+        operation               operation_;
+        price_type              price_;
+        shares_type             shares_;
+    };
+
+
+    //=========================================================================
+    // the way the books were kept before price_level_book: one std::map per side
+    class map_book
+    {
+    public:
+
+        map_book(configuration const &){}
+
+        void add
+        (
+            lime::quotation_type side,
+            price_type price,
+            shares_type shares,
+            std::uint32_t orderCount
+        )
+        {
+            if (side == lime::quotation_type::bid)
+                add(bids_, price, shares, orderCount);
+            else
+                add(asks_, price, shares, orderCount);
+        }
+
+        bool remove
+        (
+            lime::quotation_type side,
+            price_type price,
+            shares_type shares,
+            std::uint32_t orderCount
+        )
+        {
+            return (side == lime::quotation_type::bid) ? remove(bids_, price, shares, orderCount) : remove(asks_, price, shares, orderCount);
+        }
+
+        bool erase
+        (
+            lime::quotation_type side,
+            price_type price
+        )
+        {
+            return (side == lime::quotation_type::bid) ? (bids_.erase(price.get_underlying_value()) == 1) : (asks_.erase(price.get_underlying_value()) == 1);
+        }
+
+        std::uint64_t get_best_bid_value() const{return bids_.empty() ? 0 : (bids_.begin()->first + bids_.begin()->second.shares_);}
+        std::uint64_t get_best_ask_value() const{return asks_.empty() ? 0 : (asks_.begin()->first + asks_.begin()->second.shares_);}
+
+    private:
+
+        struct level
+        {
+            std::uint64_t   shares_{0};
+            std::uint32_t   orderCount_{0};
+        };
+
+        static void add
+        (
+            auto & levels,
+            price_type price,
+            shares_type shares,
+            std::uint32_t orderCount
+        )
+        {
+            auto & entry = levels[price.get_underlying_value()];
+            entry.shares_ += shares.get();
+            entry.orderCount_ += orderCount;
+        }
+
+        static bool remove
+        (
+            auto & levels,
+            price_type price,
+            shares_type shares,
+            std::uint32_t orderCount
+        )
+        {
+            auto iter = levels.find(price.get_underlying_value());
+            if (iter == levels.end())
+                return false;
+            iter->second.shares_ -= std::min(iter->second.shares_, shares.get());
+            iter->second.orderCount_ -= std::min(iter->second.orderCount_, orderCount);
+            if (iter->second.shares_ == 0)
+                levels.erase(iter);
+            return true;
+        }
+
+        std::map<std::uint64_t, level, std::greater<>>  bids_;
+        std::map<std::uint64_t, level>                  asks_;
+    };
+
+
+    //=========================================================================
+    struct lime_book
+    {
+        lime_book(configuration const & configuration):
+            book_(price_type(lime::price<>(configuration.tickSize_, price_type::precision)), configuration.windowSize_){}
+
+        void add(lime::quotation_type side, price_type price, shares_type shares, std::uint32_t orderCount){book_.add(side, price, shares, orderCount);}
+        bool remove(lime::quotation_type side, price_type price, shares_type shares, std::uint32_t orderCount){return book_.remove(side, price, shares, orderCount);}
+        bool erase(lime::quotation_type side, price_type price){return book_.erase(side, price);}
+
+        std::uint64_t get_best_bid_value() const
+        {
+            auto best = book_.get_best_bid();
+            return best ? (best->price_.get_underlying_value() + best->shares_.get()) : 0;
+        }
+
+        std::uint64_t get_best_ask_value() const
+        {
+            auto best = book_.get_best_ask();
+            return best ? (best->price_.get_underlying_value() + best->shares_.get()) : 0;
+        }
+
+        lime::price_level_book<price_type> book_;
+    };
+
+
+    //=========================================================================
+    struct order_event
+    {
+        operation               operation_;
+        lime::quotation_type    side_;
+        lime::order_id          id_;
+        price_type              price_;
+        shares_type             shares_;
+    };
+
+
+    //=========================================================================
+    // an id map to the orders with the std::map level book
+    class map_order_book
+    {
+    public:
+
+        map_order_book(configuration const & configuration):
+            levels_(configuration)
+        {
+            orders_.reserve(configuration.orderCount_);
+        }
+
+        bool add
+        (
+            lime::order_id id,
+            lime::quotation_type side,
+            price_type price,
+            shares_type shares
+        )
+        {
+            if (!orders_.try_emplace(id.get(), order{side, price, shares}).second)
+                return false;
+            levels_.add(side, price, shares, 1);
+            return true;
+        }
+
+        bool reduce
+        (
+            lime::order_id id,
+            shares_type shares
+        )
+        {
+            auto iter = orders_.find(id.get());
+            if (iter == orders_.end())
+                return false;
+            auto & order = iter->second;
+            if (shares.get() >= order.shares_.get())
+                return remove(id);
+            order.shares_ -= shares;
+            levels_.remove(order.side_, order.price_, shares, 0);
+            return true;
+        }
+
+        bool remove
+        (
+            lime::order_id id
+        )
+        {
+            auto iter = orders_.find(id.get());
+            if (iter == orders_.end())
+                return false;
+            levels_.remove(iter->second.side_, iter->second.price_, iter->second.shares_, 1);
+            orders_.erase(iter);
+            return true;
+        }
+
+        std::uint64_t get_best_bid_value() const{return levels_.get_best_bid_value();}
+        std::uint64_t get_best_ask_value() const{return levels_.get_best_ask_value();}
+
+    private:
+
+        struct order
+        {
+            lime::quotation_type    side_;
+            price_type              price_;
+            shares_type             shares_;
+        };
+
+        std::unordered_map<std::uint64_t, order>    orders_;
+
+        map_book                                    levels_;
+    };
+
+
+    //=========================================================================
+    struct lime_order_book
+    {
+        lime_order_book(configuration const & configuration):
+            book_(price_type(lime::price<>(configuration.tickSize_, price_type::precision)), configuration.orderCount_ + 1, configuration.windowSize_){}
+
+        bool add(lime::order_id id, lime::quotation_type side, price_type price, shares_type shares){return book_.add(id, side, price, shares);}
+        bool reduce(lime::order_id id, shares_type shares){return book_.reduce(id, shares);}
+        bool remove(lime::order_id id){return book_.remove(id);}
+
+        std::uint64_t get_best_bid_value() const
+        {
+            auto best = book_.get_levels().get_best_bid();
+            return best ? (best->price_.get_underlying_value() + best->shares_.get()) : 0;
+        }
+
+        std::uint64_t get_best_ask_value() const
+        {
+            auto best = book_.get_levels().get_best_ask();
+            return best ? (best->price_.get_underlying_value() + best->shares_.get()) : 0;
+        }
+
+        lime::order_book<price_type> book_;
+    };
+
+
+    //=========================================================================
+    std::vector<event> make_events
+    (
+        // the generator keeps its own view of the book so that modifies and deletes
+        // address levels which exist when the event is replayed
+        configuration const & configuration
+    )
+    {
+        std::mt19937_64 generator(11);
+        std::geometric_distribution<std::int64_t> depth(1.0 / (1.0 + configuration.meanDepth_));
+        std::uniform_int_distribution<std::uint32_t> percent(0, 99);
+        std::map<std::uint64_t, std::uint64_t> shares[2];
+
+        auto tick = configuration.tickSize_;
+        auto mid = std::int64_t(tick * 100000);
+        std::vector<event> events;
+        events.reserve(configuration.eventCount_);
+        while (events.size() < configuration.eventCount_)
+        {
+            if (percent(generator) == 0)
+                mid += (std::int64_t(generator() % 3) - 1) * std::int64_t(tick);
+            auto sideIndex = (generator() & 1);
+            auto side = (sideIndex == 0) ? lime::quotation_type::bid : lime::quotation_type::ask;
+            auto distance = (1 + depth(generator)) * std::int64_t(tick);
+            if (percent(generator) < configuration.farPercent_)
+                distance += std::int64_t(configuration.windowSize_ + (generator() % 1000)) * std::int64_t(tick);
+            auto value = std::uint64_t((sideIndex == 0) ? (mid - distance) : (mid + distance));
+
+            auto choice = percent(generator);
+            auto & levels = shares[sideIndex];
+            if ((choice < configuration.addPercent_) || levels.empty())
+            {
+                auto quantity = 100 * (1 + (generator() % 10));
+                levels[value] += quantity;
+                events.push_back({side, operation::add, price_type(lime::price<>(value, price_type::precision)), shares_type(quantity)});
+                continue;
+            }
+
+            // modify or delete an existing level near the generated price
+            auto iter = levels.lower_bound(value);
+            if (iter == levels.end())
+                iter = levels.begin();
+            value = iter->first;
+            if (choice < (configuration.addPercent_ + configuration.modifyPercent_))
+            {
+                auto quantity = std::min<std::uint64_t>(iter->second, 100);
+                if ((iter->second -= quantity) == 0)
+                    levels.erase(iter);
+                events.push_back({side, operation::remove, price_type(lime::price<>(value, price_type::precision)), shares_type(quantity)});
+            }
+            else
+            {
+                levels.erase(iter);
+                events.push_back({side, operation::erase, price_type(lime::price<>(value, price_type::precision)), shares_type(0)});
+            }
+        }
+        return events;
+    }
+
+
+    //=========================================================================
+    std::vector<order_event> make_order_events
+    (
+        // the first orderCount_ events populate the book.  after that the mix's modify
+        // percentage are partial reductions and the remainder alternate between adds and
+        // deletes of random live orders so the number of live orders stays constant.
+        configuration const & configuration
+    )
+    {
+        std::mt19937_64 generator(13);
+        std::geometric_distribution<std::int64_t> depth(1.0 / (1.0 + configuration.meanDepth_));
+        std::uniform_int_distribution<std::uint32_t> percent(0, 99);
+        struct live_order
+        {
+            std::uint64_t   id_;
+            std::uint64_t   shares_;
+        };
+        std::vector<live_order> live;
+        live.reserve(configuration.orderCount_ + 1);
+
+        auto tick = configuration.tickSize_;
+        auto mid = std::int64_t(tick * 100000);
+        auto nextId = std::uint64_t(1);
+        std::vector<order_event> events;
+        events.reserve(configuration.orderCount_ + configuration.eventCount_);
+        while (events.size() < (configuration.orderCount_ + configuration.eventCount_))
+        {
+            if (percent(generator) == 0)
+                mid += (std::int64_t(generator() % 3) - 1) * std::int64_t(tick);
+            auto populated = (events.size() >= configuration.orderCount_);
+            auto choice = percent(generator);
+            if (populated && !live.empty() && (choice < configuration.modifyPercent_))
+            {
+                auto & order = live[generator() % live.size()];
+                if (order.shares_ > 1)
+                {
+                    auto quantity = 1 + (generator() % (order.shares_ - 1));
+                    order.shares_ -= quantity;
+                    events.push_back({operation::remove, {}, lime::order_id(order.id_), {}, shares_type(quantity)});
+                    continue;
+                }
+            }
+            if (populated && (live.size() >= configuration.orderCount_) && !live.empty())
+            {
+                auto index = (generator() % live.size());
+                events.push_back({operation::erase, {}, lime::order_id(live[index].id_), {}, {}});
+                live[index] = live.back();
+                live.pop_back();
+                continue;
+            }
+
+            auto sideIndex = (generator() & 1);
+            auto distance = (1 + depth(generator)) * std::int64_t(tick);
+            if (percent(generator) < configuration.farPercent_)
+                distance += std::int64_t(configuration.windowSize_ + (generator() % 1000)) * std::int64_t(tick);
+            auto value = std::uint64_t((sideIndex == 0) ? (mid - distance) : (mid + distance));
+            auto quantity = 100 * (1 + (generator() % 10));
+            // exchanges assign ids sequentially with gaps
+            nextId += 1 + (generator() % 4);
+            live.push_back({nextId, quantity});
+            events.push_back({operation::add, (sideIndex == 0) ? lime::quotation_type::bid : lime::quotation_type::ask,
+                    lime::order_id(nextId), price_type(lime::price<>(value, price_type::precision)), shares_type(quantity)});
+        }
+        return events;
+    }
+
+
+    //=========================================================================
+    template <typename B>
+    std::pair<double, std::uint64_t> replay
+    (
+        // best of the repetitions in nanoseconds per event and a checksum of the
+        // best bid and ask seen after each event
+        configuration const & configuration,
+        std::vector<event> const & events
+    )
+    {
+        auto best = ~std::uint64_t(0);
+        std::uint64_t checksum = 0;
+        for (auto repetition = 0ull; repetition < configuration.repetitions_; ++repetition)
+        {
+            B book(configuration);
+            std::uint64_t sum = 0;
+            auto start = now_in_nanoseconds();
+            for (auto const & event : events)
+            {
+                switch (event.operation_)
+                {
+                    case operation::add: book.add(event.side_, event.price_, event.shares_, 1); break;
+                    case operation::remove: book.remove(event.side_, event.price_, event.shares_, 1); break;
+                    case operation::erase: book.erase(event.side_, event.price_); break;
+                }
+                sum += (book.get_best_bid_value() ^ book.get_best_ask_value());
+            }
+            best = std::min(best, now_in_nanoseconds() - start);
+            checksum = sum;
+        }
+        return {double(best) / events.size(), checksum};
+    }
+
+
+    //=========================================================================
+    template <typename B>
+    std::pair<double, std::uint64_t> replay_orders
+    (
+        configuration const & configuration,
+        std::vector<order_event> const & events
+    )
+    {
+        auto best = ~std::uint64_t(0);
+        std::uint64_t checksum = 0;
+        for (auto repetition = 0ull; repetition < configuration.repetitions_; ++repetition)
+        {
+            auto book = std::make_unique<B>(configuration);
+            for (auto i = 0ull; i < configuration.orderCount_; ++i)
+                book->add(events[i].id_, events[i].side_, events[i].price_, events[i].shares_);
+            std::uint64_t sum = 0;
+            auto start = now_in_nanoseconds();
+            for (auto i = configuration.orderCount_; i < events.size(); ++i)
+            {
+                auto const & event = events[i];
+                switch (event.operation_)
+                {
+                    case operation::add: sum += book->add(event.id_, event.side_, event.price_, event.shares_); break;
+                    case operation::remove: sum += book->reduce(event.id_, event.shares_); break;
+                    case operation::erase: sum += book->remove(event.id_); break;
+                }
+                sum += (book->get_best_bid_value() ^ book->get_best_ask_value());
+            }
+            best = std::min(best, now_in_nanoseconds() - start);
+            checksum = sum;
+        }
+        return {double(best) / configuration.eventCount_, checksum};
+    }
+
+
+    //=========================================================================
+    void report
+    (
+        std::string const & benchmarkName,
+        std::string const & implementation,
+        configuration const & configuration,
+        double nanosecondsPerEvent,
+        bool correct
+    )
+    {
+        json_line()
+                .add("benchmark", "book")
+                .add("test", benchmarkName)
+                .add("implementation", implementation)
+                .add("events", configuration.eventCount_)
+                .add("add_percent", configuration.addPercent_)
+                .add("modify_percent", configuration.modifyPercent_)
+                .add("delete_percent", configuration.deletePercent_)
+                .add("far_percent", configuration.farPercent_)
+                .add("orders", (benchmarkName == "orders") ? configuration.orderCount_ : 0)
+                .add("correct", correct ? 1 : 0)
+                .add("ns_per_event", nanosecondsPerEvent)
+                .add("million_per_second", 1e3 / std::max(nanosecondsPerEvent, 1e-9))
+                .print();
+    }
+
+} // namespace
+
+
+//=============================================================================
+int main
+(
+    int argc,
+    char ** argv
+)
+{
+    arguments args(argc, argv);
+    configuration configuration{};
+    configuration.eventCount_ = args.get("--events", std::uint64_t(2000000));
+    configuration.repetitions_ = std::max<std::uint64_t>(args.get("--repetitions", std::uint64_t(5)), 1);
+    configuration.tickSize_ = std::max<std::uint64_t>(args.get("--tick", std::uint64_t(100)), 1);
+    configuration.windowSize_ = args.get("--window", std::uint64_t(4096));
+    configuration.meanDepth_ = std::stod(args.get("--depth", std::string_view("8")));
+    configuration.farPercent_ = args.get("--far", std::uint64_t(1));
+    std::vector<std::uint32_t> mix;
+    for (auto const & percent : args.get_list("--mix", "45,40,15"))
+        mix.push_back(std::stoul(percent));
+    if ((mix.size() != 3) || ((mix[0] + mix[1] + mix[2]) != 100) || (configuration.eventCount_ == 0))
+        return 1;
+    configuration.addPercent_ = mix[0];
+    configuration.modifyPercent_ = mix[1];
+    configuration.deletePercent_ = mix[2];
+
+    configuration.orderCount_ = args.get("--orders", std::uint64_t(1000000));
+
+    for (auto const & benchmarkName : args.get_list("--benchmark", "levels,orders"))
+    {
+        if (benchmarkName == "levels")
+        {
+            auto events = make_events(configuration);
+            auto [referenceTime, referenceChecksum] = replay<map_book>(configuration, events);
+            auto [time, checksum] = replay<lime_book>(configuration, events);
+            report(benchmarkName, "map", configuration, referenceTime, true);
+            report(benchmarkName, "price_level_book", configuration, time, (checksum == referenceChecksum));
+        }
+        else if (benchmarkName == "orders")
+        {
+            auto events = make_order_events(configuration);
+            auto [referenceTime, referenceChecksum] = replay_orders<map_order_book>(configuration, events);
+            auto [time, checksum] = replay_orders<lime_order_book>(configuration, events);
+            report(benchmarkName, "unordered_map", configuration, referenceTime, true);
+            report(benchmarkName, "order_book", configuration, time, (checksum == referenceChecksum));
+        }
+        else
+        {
+            std::fprintf(stderr, "unknown benchmark: %s\n", benchmarkName.c_str());
+        }
+    }
+    return 0;
+}
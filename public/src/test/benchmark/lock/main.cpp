@@ -0,0 +1,188 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+// measures lock throughput and the distribution of time spent waiting to acquire
+// under contention from a configurable number of threads.
+//
+//  lock_benchmark [--lock atomic_spin_lock,instrumented_atomic_spin_lock,ticket_lock,mcs_lock,hybrid_mutex_synchronous,hybrid_mutex_asynchronous,std_mutex]
+//                 [--threads 2,4,8,16] [--iterations 100000]
+//                 [--critical-section 16] [--non-critical-section 64] [--unpinned]
+
+#include <test/benchmark/benchmark.h>
+#include <include/atomic_spin_lock.h>
+#include <include/ticket_lock.h>
+#include <include/mcs_lock.h>
+#include <include/hybrid_mutex.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+
+    using namespace lime::benchmark;
+
+
+    //=========================================================================
+    struct configuration
+    {
+        std::size_t     threads_;
+        std::uint64_t   iterations_;
+        std::uint64_t   criticalSection_;       // cpu_pause iterations while holding the lock
+        std::uint64_t   nonCriticalSection_;    // cpu_pause iterations between acquisitions
+        bool            pinned_;
+    };
+
+
+    //=========================================================================
+    template <typename L, typename ... Ts>
+    void run
+    (
+        std::string const & lockName,
+        configuration const & configuration,
+        Ts ... lockArguments
+    )
+    {
+        L lock(lockArguments ...);
+        std::uint64_t volatile counter = 0;
+        std::atomic<std::size_t> ready{0};
+        std::atomic<bool> go{false};
+        std::vector<std::vector<std::uint64_t>> samples(configuration.threads_);
+
+        auto cpus = get_cpu_topology();
+        std::vector<std::thread> threads;
+        for (auto t = 0ull; t < configuration.threads_; ++t)
+            threads.emplace_back([&, t]()
+                    {
+                        if ((configuration.pinned_) && (not cpus.empty()))
+                            pin_to_cpu(cpus[t % cpus.size()].cpu_);
+                        auto & waits = samples[t];
+                        waits.reserve(configuration.iterations_);
+                        ++ready;
+                        spin_until([&](){return go.load();});
+                        for (auto i = 0ull; i < configuration.iterations_; ++i)
+                        {
+                            auto start = now_in_nanoseconds();
+                            lock.lock();
+                            waits.push_back(now_in_nanoseconds() - start);
+                            counter = counter + 1;
+                            for (auto j = 0ull; j < configuration.criticalSection_; ++j)
+                                lime::cpu_pause();
+                            lock.unlock();
+                            for (auto j = 0ull; j < configuration.nonCriticalSection_; ++j)
+                                lime::cpu_pause();
+                        }
+                    });
+
+        spin_until([&](){return (ready.load() == configuration.threads_);});
+        auto start = now_in_nanoseconds();
+        go = true;
+        for (auto & thread : threads)
+            thread.join();
+        auto elapsed = (now_in_nanoseconds() - start);
+
+        std::vector<std::uint64_t> waits;
+        for (auto const & s : samples)
+            waits.insert(waits.end(), s.begin(), s.end());
+        auto total = waits.size();
+
+        json_line result;
+        result.add("benchmark", "lock")
+                .add("lock", lockName)
+                .add("threads", configuration.threads_)
+                .add("iterations", configuration.iterations_)
+                .add("critical_section", configuration.criticalSection_)
+                .add("non_critical_section", configuration.nonCriticalSection_)
+                .add("pinned", configuration.pinned_ ? 1 : 0)
+                .add("correct", (counter == total) ? 1 : 0)
+                .add("acquisitions_per_second", (total * 1e9) / std::max<std::uint64_t>(elapsed, 1))
+                .add("wait_ns", get_latency_statistics(std::move(waits)));
+        if constexpr (requires {lock.get_statistics();})
+        {
+            auto statistics = lock.get_statistics();
+            result.add("contended_acquisitions", statistics.contendedAcquisitions_)
+                    .add("spins", statistics.spins_)
+                    .add("maximum_hold_ns", statistics.maximumHoldTime_.count());
+        }
+        result.print();
+    }
+
+
+    //=========================================================================
+    void run
+    (
+        std::string const & lockName,
+        configuration const & configuration
+    )
+    {
+        if (lockName == "atomic_spin_lock")
+            run<lime::atomic_spin_lock>(lockName, configuration);
+        else if (lockName == "instrumented_atomic_spin_lock")
+            run<lime::instrumented_atomic_spin_lock>(lockName, configuration);
+        else if (lockName == "ticket_lock")
+            run<lime::ticket_lock>(lockName, configuration);
+        else if (lockName == "mcs_lock")
+            run<lime::mcs_lock>(lockName, configuration);
+        else if (lockName == "hybrid_mutex_synchronous")
+            run<lime::hybrid_mutex>(lockName, configuration, lime::synchronization_mode::synchronous);
+        else if (lockName == "hybrid_mutex_asynchronous")
+            run<lime::hybrid_mutex>(lockName, configuration, lime::synchronization_mode::asynchronous);
+        else if (lockName == "std_mutex")
+            run<std::mutex>(lockName, configuration);
+        else
+            std::fprintf(stderr, "unknown lock: %s\n", lockName.c_str());
+    }
+
+} // namespace
+
+
+//=============================================================================
+int main
+(
+    int argc,
+    char ** argv
+)
+{
+    arguments args(argc, argv);
+    auto lockNames = args.get_list("--lock", "atomic_spin_lock,instrumented_atomic_spin_lock,ticket_lock,mcs_lock,hybrid_mutex_synchronous,hybrid_mutex_asynchronous,std_mutex");
+    auto iterations = args.get("--iterations", std::uint64_t(100000));
+    auto criticalSection = args.get("--critical-section", std::uint64_t(16));
+    auto nonCriticalSection = args.get("--non-critical-section", std::uint64_t(64));
+    auto pinned = not args.has("--unpinned");
+
+    for (auto const & threads : args.get_list("--threads", "2,4,8,16"))
+        for (auto const & lockName : lockNames)
+            run(lockName, {std::stoull(threads), iterations, criticalSection, nonCriticalSection, pinned});
+    return 0;
+}
@@ -0,0 +1,415 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+// measures throughput of price comparison, sorting and rescaling on arrays of prices
+// with mixed precisions, against a reference which rescales with pow_10 and integer division.
+// parse measures converting ascii decimals to fixed_price against std::from_chars to double
+// followed by scaling.  batch measures the double <-> fixed_price array conversions at each
+// simd level supported by the cpu.
+//
+//  price_benchmark [--benchmark compare,sort,rescale,parse,batch] [--count 1000000] [--repetitions 5]
+//                  [--precisions 2,4,6]
+
+#include <test/benchmark/benchmark.h>
+#include <include/quotation.h>
+#include <include/quotation/fixed_price_batch.h>
+#include <include/quotation/notional_batch.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+
+    using namespace lime::benchmark;
+
+
+    //=========================================================================
+    struct configuration
+    {
+        std::size_t                 count_;
+        std::uint64_t               repetitions_;
+        std::vector<std::uint8_t>   precisions_;
+    };
+
+
+    //=========================================================================
+    // rescaling as it was done prior to the reciprocal table: multiply up or divide down
+    struct reference
+    {
+        static bool less
+        (
+            lime::price<> const & first,
+            lime::price<> const & second
+        )
+        {
+            auto a = first.get_underlying_value();
+            auto b = second.get_underlying_value();
+            if (first.get_precision() < second.get_precision())
+                a *= lime::pow_10(second.get_precision() - first.get_precision());
+            else if (first.get_precision() > second.get_precision())
+                b *= lime::pow_10(first.get_precision() - second.get_precision());
+            return (a < b);
+        }
+
+        static void set_precision
+        (
+            lime::price<> & price,
+            std::uint8_t precision
+        )
+        {
+            auto value = price.get_underlying_value();
+            if (precision < price.get_precision())
+                value /= lime::pow_10(price.get_precision() - precision);
+            else
+                value *= lime::pow_10(precision - price.get_precision());
+            price = lime::price<>(value, precision);
+        }
+    };
+
+
+    //=========================================================================
+    std::vector<lime::price<>> make_prices
+    (
+        configuration const & configuration,
+        std::uint64_t seed
+    )
+    {
+        // between $1 and $1000 at each of the configured precisions
+        std::mt19937_64 generator(seed);
+        std::vector<lime::price<>> prices;
+        prices.reserve(configuration.count_);
+        for (auto i = 0ull; i < configuration.count_; ++i)
+        {
+            auto precision = configuration.precisions_[generator() % configuration.precisions_.size()];
+            auto scale = lime::pow_10(precision);
+            prices.emplace_back(scale + (generator() % (999 * scale)), precision);
+        }
+        return prices;
+    }
+
+
+    //=========================================================================
+    template <typename F>
+    double measure
+    (
+        // best of the repetitions, in nanoseconds per element
+        configuration const & configuration,
+        F && function
+    )
+    {
+        auto best = ~std::uint64_t(0);
+        for (auto repetition = 0ull; repetition < configuration.repetitions_; ++repetition)
+        {
+            auto start = now_in_nanoseconds();
+            function();
+            best = std::min(best, now_in_nanoseconds() - start);
+        }
+        return (double(best) / configuration.count_);
+    }
+
+
+    //=========================================================================
+    void report
+    (
+        std::string const & benchmarkName,
+        std::string const & implementation,
+        configuration const & configuration,
+        double nanosecondsPerElement,
+        bool correct
+    )
+    {
+        json_line()
+                .add("benchmark", "price")
+                .add("test", benchmarkName)
+                .add("implementation", implementation)
+                .add("count", configuration.count_)
+                .add("correct", correct ? 1 : 0)
+                .add("ns_per_element", nanosecondsPerElement)
+                .add("million_per_second", 1e3 / std::max(nanosecondsPerElement, 1e-9))
+                .print();
+    }
+
+
+    //=========================================================================
+    void run_compare
+    (
+        configuration const & configuration
+    )
+    {
+        auto first = make_prices(configuration, 1);
+        auto second = make_prices(configuration, 2);
+        std::uint64_t volatile sink = 0;
+        std::uint64_t expected = 0;
+        std::uint64_t actual = 0;
+        auto referenceTime = measure(configuration, [&]()
+                {
+                    std::uint64_t count = 0;
+                    for (auto i = 0ull; i < first.size(); ++i)
+                        count += reference::less(first[i], second[i]);
+                    sink = expected = count;
+                });
+        auto time = measure(configuration, [&]()
+                {
+                    std::uint64_t count = 0;
+                    for (auto i = 0ull; i < first.size(); ++i)
+                        count += (first[i] < second[i]);
+                    sink = actual = count;
+                });
+        report("compare", "reference", configuration, referenceTime, true);
+        report("compare", "price", configuration, time, (actual == expected));
+    }
+
+
+    //=========================================================================
+    void run_sort
+    (
+        configuration const & configuration
+    )
+    {
+        auto prices = make_prices(configuration, 3);
+        std::vector<lime::price<>> referenceSorted;
+        std::vector<lime::price<>> sorted;
+        auto referenceTime = measure(configuration, [&]()
+                {
+                    referenceSorted = prices;
+                    std::sort(referenceSorted.begin(), referenceSorted.end(), reference::less);
+                });
+        auto time = measure(configuration, [&]()
+                {
+                    sorted = prices;
+                    std::sort(sorted.begin(), sorted.end());
+                });
+        auto correct = std::equal(sorted.begin(), sorted.end(), referenceSorted.begin(),
+                [](auto const & a, auto const & b){return (a == b);});
+        report("sort", "reference", configuration, referenceTime, true);
+        report("sort", "price", configuration, time, correct);
+    }
+
+
+    //=========================================================================
+    void run_rescale
+    (
+        configuration const & configuration
+    )
+    {
+        // every price to each configured precision in turn (both up and down)
+        auto prices = make_prices(configuration, 4);
+        std::vector<lime::price<>> referenceRescaled;
+        std::vector<lime::price<>> rescaled;
+        auto referenceTime = measure(configuration, [&]()
+                {
+                    referenceRescaled = prices;
+                    for (auto precision : configuration.precisions_)
+                        for (auto & price : referenceRescaled)
+                            reference::set_precision(price, precision);
+                });
+        auto time = measure(configuration, [&]()
+                {
+                    rescaled = prices;
+                    for (auto precision : configuration.precisions_)
+                        for (auto & price : rescaled)
+                            price.set_precision(precision);
+                });
+        auto correct = std::equal(rescaled.begin(), rescaled.end(), referenceRescaled.begin(),
+                [](auto const & a, auto const & b){return (a.get_underlying_value() == b.get_underlying_value());});
+        auto passes = configuration.precisions_.size();
+        report("rescale", "reference", configuration, referenceTime / passes, true);
+        report("rescale", "price", configuration, time / passes, correct);
+    }
+
+
+    //=========================================================================
+    void run_parse
+    (
+        configuration const & configuration
+    )
+    {
+        // the prices as text parsed into a fixed_price of the highest configured precision
+        using fixed_price_type = lime::fixed_price<6>;
+        auto prices = make_prices(configuration, 5);
+        std::vector<std::string> text;
+        text.reserve(prices.size());
+        for (auto const & price : prices)
+            if (price.get_precision() <= fixed_price_type::precision)
+                text.push_back(lime::to_string(price));
+        if (text.empty())
+            return;
+
+        std::vector<std::uint64_t> referenceParsed(text.size());
+        std::vector<std::uint64_t> parsed(text.size());
+        auto referenceTime = measure(configuration, [&]()
+                {
+                    for (auto i = 0ull; i < text.size(); ++i)
+                    {
+                        double value = 0;
+                        std::from_chars(text[i].data(), text[i].data() + text[i].size(), value);
+                        referenceParsed[i] = std::llround(value * fixed_price_type::scale);
+                    }
+                });
+        auto time = measure(configuration, [&]()
+                {
+                    for (auto i = 0ull; i < text.size(); ++i)
+                    {
+                        fixed_price_type value{};
+                        lime::from_chars(text[i].data(), text[i].data() + text[i].size(), value);
+                        parsed[i] = value.get_underlying_value();
+                    }
+                });
+        report("parse", "from_chars_double", configuration, referenceTime * configuration.count_ / text.size(), true);
+        report("parse", "fixed_price", configuration, time * configuration.count_ / text.size(), (parsed == referenceParsed));
+    }
+
+
+    //=========================================================================
+    void run_batch
+    (
+        configuration const & configuration
+    )
+    {
+        using fixed_price_type = lime::fixed_price<6>;
+        std::vector<double> values;
+        values.reserve(configuration.count_);
+        for (auto const & price : make_prices(configuration, 6))
+            values.push_back(double(price));
+
+        std::vector<fixed_price_type> referencePrices(values.size());
+        std::vector<double> referenceValues(values.size());
+        auto detected = lime::detect_simd_level();
+        for (auto simdLevel : {lime::simd_level::scalar, lime::simd_level::avx2, lime::simd_level::avx512})
+        {
+            if (simdLevel > detected)
+                break;
+            lime::set_simd_level(simdLevel);
+            std::vector<fixed_price_type> prices(values.size());
+            std::vector<double> convertedValues(values.size());
+            auto toFixedPriceTime = measure(configuration, [&](){lime::convert_to_fixed_price(std::span<double const>(values), std::span(prices));});
+            auto toDoubleTime = measure(configuration, [&](){lime::convert_to_double(std::span<fixed_price_type const>(prices), std::span(convertedValues));});
+            if (simdLevel == lime::simd_level::scalar)
+            {
+                referencePrices = prices;
+                referenceValues = convertedValues;
+            }
+            auto samePrices = std::equal(prices.begin(), prices.end(), referencePrices.begin(),
+                    [](auto const & a, auto const & b){return (a.get_underlying_value() == b.get_underlying_value());});
+            report("to_fixed_price", std::string(lime::to_string(simdLevel)), configuration, toFixedPriceTime, samePrices);
+            report("to_double", std::string(lime::to_string(simdLevel)), configuration, toDoubleTime, (convertedValues == referenceValues));
+        }
+        lime::set_simd_level(detected);
+    }
+
+    //=========================================================================
+    void run_notional
+    (
+        configuration const & configuration
+    )
+    {
+        using fixed_price_type = lime::fixed_price<6>;
+        std::mt19937_64 generator(7);
+        std::vector<fixed_price_type> marks;
+        std::vector<fixed_price_type> costs;
+        std::vector<std::int64_t> positions;
+        for (auto const & price : make_prices(configuration, 7))
+        {
+            marks.emplace_back(price);
+            costs.emplace_back(lime::price<>(price.get_underlying_value() + (generator() % 100), price.get_precision()));
+            positions.push_back(std::int64_t(generator() % 20001) - 10000);
+        }
+
+        // the sum of int64 products without overflow detection as a baseline
+        auto referenceSum = std::int64_t(0);
+        auto referenceTime = measure(configuration, [&]()
+                {
+                    auto sum = std::int64_t(0);
+                    for (auto i = 0ull; i < marks.size(); ++i)
+                        sum += std::int64_t(marks[i].get_underlying_value() - costs[i].get_underlying_value()) * positions[i];
+                    referenceSum = sum;
+                });
+        report("profit_and_loss", "int64", configuration, referenceTime, true);
+
+        auto expected = lime::notional<6>::from_wide_integer(referenceSum, 6);
+        auto detected = lime::detect_simd_level();
+        for (auto simdLevel : {lime::simd_level::scalar, lime::simd_level::avx2, lime::simd_level::avx512})
+        {
+            if (simdLevel > detected)
+                break;
+            lime::set_simd_level(simdLevel);
+            lime::notional<6> result;
+            auto time = measure(configuration, [&]()
+                    {
+                        result = lime::aggregate_profit_and_loss<6>(std::span<fixed_price_type const>(marks),
+                                std::span<fixed_price_type const>(costs), std::span<std::int64_t const>(positions));
+                    });
+            report("profit_and_loss", std::string(lime::to_string(simdLevel)), configuration, time, (result == expected));
+        }
+        lime::set_simd_level(detected);
+    }
+
+} // namespace
+
+
+//=============================================================================
+int main
+(
+    int argc,
+    char ** argv
+)
+{
+    arguments args(argc, argv);
+    configuration configuration{args.get("--count", std::uint64_t(1000000)), std::max<std::uint64_t>(args.get("--repetitions", std::uint64_t(5)), 1), {}};
+    for (auto const & precision : args.get_list("--precisions", "2,4,6"))
+        configuration.precisions_.push_back(std::stoul(precision));
+    if (configuration.precisions_.empty() || (configuration.count_ == 0))
+        return 1;
+
+    for (auto const & benchmarkName : args.get_list("--benchmark", "compare,sort,rescale,parse,batch,notional"))
+    {
+        if (benchmarkName == "compare")
+            run_compare(configuration);
+        else if (benchmarkName == "sort")
+            run_sort(configuration);
+        else if (benchmarkName == "rescale")
+            run_rescale(configuration);
+        else if (benchmarkName == "parse")
+            run_parse(configuration);
+        else if (benchmarkName == "batch")
+            run_batch(configuration);
+        else if (benchmarkName == "notional")
+            run_notional(configuration);
+        else
+            std::fprintf(stderr, "unknown benchmark: %s\n", benchmarkName.c_str());
+    }
+    return 0;
+}
@@ -0,0 +1,363 @@
+/*
+MIT License
+
+Copyright (c) 2025 Lime Trading
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+/*
+    Contributors: MAM
+    Creation Date:  October 19th, 2026
+*/
+
+// measures round trip latency and throughput of the queue types between a pair of
+// cpus chosen by core topology.
+//
+//  queue_benchmark [--queue spsc_fixed_queue,spsc_static_queue,spsc_shared_memory_queue,broadcast_ring]
+//                  [--element-size 8,64,256] [--topology same_core,same_socket,cross_numa]
+//                  [--cpus <producer>,<consumer>] [--iterations 100000] [--capacity 1024]
+
+#include <test/benchmark/benchmark.h>
+#include <include/spsc_fixed_queue.h>
+#include <include/spsc_static_queue.h>
+#include <include/spsc_shared_memory_queue.h>
+#include <include/broadcast_ring.h>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace
+{
+
+    using namespace lime::benchmark;
+
+    static auto constexpr static_queue_capacity = std::size_t(1024);
+
+
+    //=========================================================================
+    template <std::size_t N>
+    struct payload
+    {
+        static_assert(N >= sizeof(std::uint64_t));
+
+        std::uint64_t                                   sequence_;
+        std::array<std::byte, N - sizeof(std::uint64_t)> padding_;
+    };
+
+
+    //=========================================================================
+    template <typename T>
+    class fixed_queue
+    {
+    public:
+        using value_type = T;
+        static auto constexpr name = "spsc_fixed_queue";
+        fixed_queue(std::size_t capacity):queue_(capacity){}
+        bool push(T const & value){return queue_.push(value);}
+        bool try_pop(T & value){return (queue_.try_pop(value) > 0);}
+        std::size_t capacity() const{return queue_.capacity();}
+    private:
+        lime::spsc_fixed_queue<T> queue_;
+    };
+
+
+    //=========================================================================
+    template <typename T>
+    class static_queue
+    {
+    public:
+        using value_type = T;
+        static auto constexpr name = "spsc_static_queue";
+        static_queue(std::size_t):queue_(std::make_unique<queue_type>()){}
+        bool push(T const & value){return queue_->push(value);}
+        bool try_pop(T & value){return (queue_->try_pop(value) > 0);}
+        std::size_t capacity() const{return queue_->capacity();}
+    private:
+        using queue_type = lime::spsc_static_queue<T, static_queue_capacity>;
+        std::unique_ptr<queue_type> queue_;
+    };
+
+
+    //=========================================================================
+    template <typename T>
+    class shared_memory_queue
+    {
+    public:
+        using value_type = T;
+        // producer and consumer use separate mappings of the same segment as they would in separate processes
+        static auto constexpr name = "spsc_shared_memory_queue";
+        shared_memory_queue(std::size_t capacity):
+            producer_(lime::spsc_shared_memory_queue<T>::create(capacity)),
+            consumer_(producer_ ? lime::spsc_shared_memory_queue<T>::open(producer_->get_file_descriptor()) : std::nullopt)
+        {
+            if ((not producer_) || (not consumer_))
+            {
+                std::fprintf(stderr, "unable to %s shared memory queue\n", producer_ ? "open" : "create");
+                std::exit(EXIT_FAILURE);
+            }
+        }
+        bool push(T const & value){return producer_->push(value);}
+        bool try_pop(T & value){return (consumer_->try_pop(value) > 0);}
+        std::size_t capacity() const{return producer_->capacity();}
+    private:
+        std::optional<lime::spsc_shared_memory_queue<T>> producer_;
+        std::optional<lime::spsc_shared_memory_queue<T>> consumer_;
+    };
+
+
+    //=========================================================================
+    template <typename T>
+    class broadcast_ring
+    {
+    public:
+        using value_type = T;
+        static auto constexpr name = "broadcast_ring";
+        broadcast_ring(std::size_t capacity):ring_(capacity, 1), reader_(ring_.get_reader(0)){}
+        bool push(T const & value){return ring_.push(value);}
+        bool try_pop(T & value){return reader_.try_pop(value);}
+        std::size_t capacity() const{return ring_.capacity();}
+    private:
+        lime::broadcast_ring<T> ring_;
+        typename lime::broadcast_ring<T>::reader reader_;
+    };
+
+
+    //=========================================================================
+    struct configuration
+    {
+        std::string     topology_;
+        int             producerCpu_;
+        int             consumerCpu_;
+        std::uint64_t   iterations_;
+        std::size_t     capacity_;
+    };
+
+
+    //=========================================================================
+    template <typename Q>
+    latency_statistics measure_round_trip
+    (
+        configuration const & configuration
+    )
+    {
+        using value_type = typename Q::value_type;
+
+        Q ping(configuration.capacity_);
+        Q pong(configuration.capacity_);
+        auto const warmUp = (configuration.iterations_ / 10);
+        auto const total = (warmUp + configuration.iterations_);
+
+        std::thread echo([&]()
+                {
+                    pin_to_cpu(configuration.consumerCpu_);
+                    value_type value{};
+                    for (auto i = 0ull; i < total; ++i)
+                    {
+                        spin_until([&](){return ping.try_pop(value);});
+                        spin_until([&](){return pong.push(value);});
+                    }
+                });
+
+        pin_to_cpu(configuration.producerCpu_);
+        std::vector<std::uint64_t> samples;
+        samples.reserve(configuration.iterations_);
+        value_type value{};
+        for (auto i = 0ull; i < total; ++i)
+        {
+            value.sequence_ = i;
+            auto start = now_in_nanoseconds();
+            spin_until([&](){return ping.push(value);});
+            spin_until([&](){return pong.try_pop(value);});
+            auto finish = now_in_nanoseconds();
+            if (i >= warmUp)
+                samples.push_back(finish - start);
+        }
+        echo.join();
+        return get_latency_statistics(std::move(samples));
+    }
+
+
+    //=========================================================================
+    template <typename Q>
+    double measure_throughput
+    (
+        // values per second from a producer to a consumer which never waits on each other except when full/empty
+        configuration const & configuration
+    )
+    {
+        using value_type = typename Q::value_type;
+
+        Q queue(configuration.capacity_);
+        auto const count = (configuration.iterations_ * 10);
+        std::atomic<bool> ready{false};
+        std::uint64_t finish = 0;
+
+        std::thread consumer([&]()
+                {
+                    pin_to_cpu(configuration.consumerCpu_);
+                    ready = true;
+                    value_type value{};
+                    for (auto i = 0ull; i < count; ++i)
+                        spin_until([&](){return queue.try_pop(value);});
+                    finish = now_in_nanoseconds();
+                });
+
+        pin_to_cpu(configuration.producerCpu_);
+        spin_until([&](){return ready.load();});
+        auto start = now_in_nanoseconds();
+        value_type value{};
+        for (auto i = 0ull; i < count; ++i)
+        {
+            value.sequence_ = i;
+            spin_until([&](){return queue.push(value);});
+        }
+        consumer.join();
+        return (count * 1e9) / std::max<std::uint64_t>(finish - start, 1);
+    }
+
+
+    //=========================================================================
+    template <template <typename> class Q, std::size_t N>
+    void run
+    (
+        configuration const & configuration
+    )
+    {
+        using queue_type = Q<payload<N>>;
+        auto capacity = queue_type(configuration.capacity_).capacity();
+        auto roundTrip = measure_round_trip<queue_type>(configuration);
+        auto throughput = measure_throughput<queue_type>(configuration);
+        json_line()
+                .add("benchmark", "queue")
+                .add("queue", queue_type::name)
+                .add("element_size", N)
+                .add("capacity", capacity)
+                .add("topology", configuration.topology_)
+                .add("producer_cpu", configuration.producerCpu_)
+                .add("consumer_cpu", configuration.consumerCpu_)
+                .add("round_trip_ns", roundTrip)
+                .add("throughput_per_second", throughput)
+                .add("throughput_bytes_per_second", throughput * N)
+                .print();
+    }
+
+
+    //=========================================================================
+    template <std::size_t N>
+    void run
+    (
+        std::string const & queueName,
+        configuration const & configuration
+    )
+    {
+        if (queueName == fixed_queue<payload<N>>::name)
+            run<fixed_queue, N>(configuration);
+        else if (queueName == static_queue<payload<N>>::name)
+            run<static_queue, N>(configuration);
+        else if (queueName == shared_memory_queue<payload<N>>::name)
+            run<shared_memory_queue, N>(configuration);
+        else if (queueName == broadcast_ring<payload<N>>::name)
+            run<broadcast_ring, N>(configuration);
+        else
+            std::fprintf(stderr, "unknown queue: %s\n", queueName.c_str());
+    }
+
+
+    //=========================================================================
+    void run
+    (
+        std::string const & queueName,
+        std::size_t elementSize,
+        configuration const & configuration
+    )
+    {
+        switch (elementSize)
+        {
+            case 8: run<8>(queueName, configuration); break;
+            case 16: run<16>(queueName, configuration); break;
+            case 32: run<32>(queueName, configuration); break;
+            case 64: run<64>(queueName, configuration); break;
+            case 128: run<128>(queueName, configuration); break;
+            case 256: run<256>(queueName, configuration); break;
+            case 512: run<512>(queueName, configuration); break;
+            case 1024: run<1024>(queueName, configuration); break;
+            default: std::fprintf(stderr, "unsupported element size: %zu (8, 16, 32, ... 1024)\n", elementSize); break;
+        }
+    }
+
+} // namespace
+
+
+//=============================================================================
+int main
+(
+    int argc,
+    char ** argv
+)
+{
+    arguments args(argc, argv);
+    auto queueNames = args.get_list("--queue", "spsc_fixed_queue,spsc_static_queue,spsc_shared_memory_queue,broadcast_ring");
+    auto elementSizes = args.get_list("--element-size", "8,64,256");
+    auto iterations = args.get("--iterations", std::uint64_t(100000));
+    auto capacity = args.get("--capacity", std::uint64_t(1024));
+
+    std::vector<configuration> configurations;
+    if (auto cpus = args.get_list("--cpus", ""); cpus.size() == 2)
+    {
+        configurations.push_back({"explicit", std::stoi(cpus[0]), std::stoi(cpus[1]), iterations, capacity});
+    }
+    else
+    {
+        auto cpuTopology = get_cpu_topology();
+        for (auto const & name : args.get_list("--topology", "same_core,same_socket,cross_numa"))
+        {
+            auto coreTopology = to_core_topology(name);
+            if (not coreTopology)
+            {
+                std::fprintf(stderr, "unknown topology: %s\n", name.c_str());
+                continue;
+            }
+            if (*coreTopology == core_topology::unpinned)
+                configurations.push_back({name, -1, -1, iterations, capacity});
+            else if (auto cpuPair = find_cpu_pair(*coreTopology, cpuTopology); cpuPair)
+                configurations.push_back({name, cpuPair->first, cpuPair->second, iterations, capacity});
+            else
+                std::fprintf(stderr, "no cpu pair available for topology: %s\n", name.c_str());
+        }
+        if (configurations.empty())
+            configurations.push_back({std::string(to_string(core_topology::unpinned)), -1, -1, iterations, capacity});
+    }
+
+    for (auto const & configuration : configurations)
+        for (auto const & elementSize : elementSizes)
+            for (auto const & queueName : queueNames)
+                run(queueName, std::stoull(elementSize), configuration);
+    return 0;
+}